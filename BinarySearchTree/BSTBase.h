@@ -1,20 +1,36 @@
 #pragma once
 
+#include <algorithm>
+#include <optional>
 #include <vector>
 
 #include "BSTBaseIt.h"
+#include "BSTTraversalIt.h"
+#include "TreeNode.h"
+#include "TreeStats.h"
+
+#include "../Utility/RunParallel.h"
 
 // TODO: Add Node-independent copy (and maybe compare) operator, so trees with different node types can be assigned to each other
 
 // T must have < and > operators (Replace with C++20 concepts)
 // Node must basically be a class almost identical to TreeNode, or one that inherits from it (Also replace with C++20 concepts if possible)
+// If Node has a count member (see IsCountedNode), equal keys share one node and count is the number of copies
 template <typename T, template <typename> class Node>
 class BSTBase {
    protected:
     std::unique_ptr<Node<T>> root_;
 
+#ifdef BST_ENABLE_STATS
+    mutable TreeStats stats_;
+#endif
+
    public:
     using iterator = BSTBaseIt<T, Node>;
+    using inorderIterator = BSTOrderIt<T, Node, TraversalOrder::INORDER>;
+    using preorderIterator = BSTOrderIt<T, Node, TraversalOrder::PREORDER>;
+    using postorderIterator = BSTOrderIt<T, Node, TraversalOrder::POSTORDER>;
+    using levelorderIterator = BSTLevelOrderIt<T, Node>;
     BSTBase() : root_(nullptr) {}
     BSTBase(const BSTBase<T, Node>& tree);
     BSTBase(BSTBase<T, Node>&& tree) noexcept;
@@ -33,6 +49,8 @@ class BSTBase {
 
     void clear();
 
+    bool compact(size_t maxNodes);
+
     template <class Container>
     Container inorder() const;
     template <class Container>
@@ -40,12 +58,32 @@ class BSTBase {
     template <class Container>
     Container postorder() const;
 
+    // Lazy traversals that visit the keys on demand, while the tree is not modified
+    BSTTraversal<inorderIterator> inorderRange() const;
+    BSTTraversal<preorderIterator> preorderRange() const;
+    BSTTraversal<postorderIterator> postorderRange() const;
+    BSTTraversal<levelorderIterator> levelorderRange() const;
+
+    template <class Function>
+    void parallelForEach(Function function, size_t threadCount = 0) const;
+    template <class Result, class Accumulate, class Combine>
+    Result parallelReduce(Result init, Accumulate accumulate, Combine combine, size_t threadCount = 0) const;
+
     bool isEmpty() const;
 
     size_t computeHeight() const;
     size_t computeSize() const;
+    std::vector<size_t> computeDepthHistogram() const;
+
+#ifdef BST_ENABLE_STATS
+    const TreeStats& stats() const;
+    void resetStats();
+#endif
 
     iterator find(const T& key) const;
+    template <class KeyContainer, class ItContainer>
+    void findMany(const KeyContainer& keys, ItContainer& result) const;
+    size_t count(const T& key) const;
 
     iterator min() const;
     iterator max() const;
@@ -62,6 +100,8 @@ class BSTBase {
     Node<T>* getPtr(iterator it);
 
     Node<T>* insertAndReturnNewNode(const T& key);
+    bool decrementMultiplicity(Node<T>* node);
+    size_t multiplicity(const Node<T>* node) const;
     void erase(Node<T>* toDelete);
     Node<T>* findReplacement(Node<T>* node);
 
@@ -79,17 +119,39 @@ class BSTBase {
     void transplant(Node<T>* toDelete, std::unique_ptr<Node<T>>& replacement);
 
    private:
+    std::optional<T> compactResumeKey_;  // Key of the last node compact() moved
+    size_t compactResumeCopies_ = 0;  // Number of nodes with that key compact() already moved in this pass
+    std::vector<std::unique_ptr<Node<T>>> compactRetired_;  // Old nodes of the current compact() pass
+
+    static constexpr size_t findManyGroupSize = 16;  // Number of searches findMany() advances in lockstep
+    static constexpr size_t segmentsPerThread = 8;  // Parallel traversals split the tree into about this many parts per thread
+
+    // Part of the tree that a parallel traversal hands to a single thread
+    struct TraversalSegment {
+        const Node<T>* node;
+        bool wholeSubtree;  // Otherwise just the node itself
+    };
+
+    static void prefetch(const Node<T>* node);
+
     size_t subtreeHeight(Node<T>* subTreeRoot) const;
     size_t subtreeSize(Node<T>* subTreeRoot) const;
+    size_t subtreeCount(Node<T>* subtreeRoot, const T& key) const;
+
+    Node<T>* successor(Node<T>* node) const;
+    Node<T>* firstNotLess(const T& key) const;
+    std::unique_ptr<Node<T>> relocate(Node<T>* node, std::unique_ptr<Node<T>>& newNode);
+    void subtreeDepthHistogram(Node<T>* subtreeRoot, size_t depth, std::vector<size_t>& histogram) const;
+
+    std::vector<TraversalSegment> splitIntoSegments(size_t threadCount) const;
+    void subtreeSegments(const Node<T>* subtreeRoot, size_t depth, std::vector<TraversalSegment>& segments) const;
+    template <class Function>
+    void segmentForEach(const TraversalSegment& segment, Function& function) const;
 
     std::unique_ptr<Node<T>> copySubtree(const Node<T>* node);
 
-    template <class Container>
-    void subtreeInorder(Node<T>* subtreeRoot, Container& trav, size_t& currentIndex) const;
-    template <class Container>
-    void subtreePreorder(Node<T>* subtreeRoot, Container& trav, size_t& currentIndex) const;
-    template <class Container>
-    void subtreePostorder(Node<T>* subtreeRoot, Container& trav, size_t& currentIndex) const;
+    template <class Container, class Range>
+    Container collect(const Range& range) const;
 };
 
 // Constructors
@@ -109,7 +171,9 @@ BSTBase<T, Node>::BSTBase(BSTBase<T, Node>&& tree) noexcept : root_(std::move(tr
 template <typename T, template <typename> class Node>
 BSTBase<T, Node>& BSTBase<T, Node>::operator=(const BSTBase<T, Node>& tree) {
     root_ = copySubtree(tree.root_.get());
-    
+    compactResumeKey_.reset();
+    compactRetired_.clear();
+
     return *this;
 }
 
@@ -117,6 +181,10 @@ template <typename T, template <typename> class Node>
 BSTBase<T, Node>& BSTBase<T, Node>::operator=(BSTBase<T, Node>&& tree) {
     root_ = std::move(tree.root_);
     tree.root_ = nullptr;
+    compactResumeKey_.reset();
+    compactRetired_.clear();
+    tree.compactResumeKey_.reset();
+    tree.compactRetired_.clear();
 
     return *this;
 }
@@ -143,13 +211,13 @@ void BSTBase<T, Node>::insert(const T& key) {  // O(h)
 template <typename T, template <typename> class Node>
 void BSTBase<T, Node>::erase(const T& key) {  // O(h)
     Node<T>* toDelete = findNode(key);
-    if (toDelete != nullptr)
+    if (toDelete != nullptr && !decrementMultiplicity(toDelete))
         erase(toDelete);
 }
 
 template <typename T, template <typename> class Node>
-void BSTBase<T, Node>::erase(iterator& it) {
-    if (it.currentNode_ != nullptr) {
+void BSTBase<T, Node>::erase(iterator& it) {  // Only invalidates it if the last copy of the key was erased
+    if (it.currentNode_ != nullptr && !decrementMultiplicity(it.currentNode_)) {
         erase(it.currentNode_);
         it.invalidate();
     }
@@ -157,7 +225,7 @@ void BSTBase<T, Node>::erase(iterator& it) {
 
 template <typename T, template <typename> class Node>
 void BSTBase<T, Node>::erase(iterator&& it) {
-    if (it.currentNode_ != nullptr) {
+    if (it.currentNode_ != nullptr && !decrementMultiplicity(it.currentNode_)) {
         erase(it.currentNode_);
         it.invalidate();
     }
@@ -168,6 +236,52 @@ void BSTBase<T, Node>::erase(iterator&& it) {
 template <typename T, template <typename> class Node>
 void BSTBase<T, Node>::clear() {
     root_ = nullptr;
+    compactResumeKey_.reset();
+    compactRetired_.clear();
+}
+
+// Moves up to maxNodes nodes to newly allocated memory in inorder sequence, continuing after the node where the
+// previous call stopped, so neighbours in key order end up next to each other in memory.
+// Keys are moved, not copied. The emptied old nodes are only freed when the pass reaches the end of the tree,
+// otherwise the allocator would hand them out again for the next nodes and recreate the scattered layout.
+// Returns true when the pass is complete (the next call starts over at the minimum).
+// The shape of the tree does not change, but iterators to moved nodes are invalidated.
+template <typename T, template <typename> class Node>
+bool BSTBase<T, Node>::compact(size_t maxNodes) {  // O(h + maxNodes), the last call of a pass also frees the old nodes
+    Node<T>* node;
+    if (compactResumeKey_.has_value()) {
+        // Equal keys can be spread over several nodes, so skip the ones that were already moved instead of the key
+        node = firstNotLess(*compactResumeKey_);
+        for (size_t skipped = 0; node != nullptr && !(node->key > *compactResumeKey_) && skipped < compactResumeCopies_; ++skipped)
+            node = successor(node);
+    } else {
+        node = subtreeMin(root_.get());
+    }
+
+    const T* lastKey = compactResumeKey_.has_value() ? &*compactResumeKey_ : nullptr;
+    Node<T>* lastMoved = nullptr;
+    for (size_t moved = 0; node != nullptr && moved < maxNodes; ++moved) {
+        std::unique_ptr<Node<T>> newNode = std::make_unique<Node<T>>(std::move(*node));
+        lastMoved = newNode.get();
+        compactRetired_.push_back(relocate(node, newNode));
+
+        if (lastKey != nullptr && !(lastMoved->key > *lastKey) && !(*lastKey > lastMoved->key))
+            ++compactResumeCopies_;
+        else
+            compactResumeCopies_ = 1;
+        lastKey = &lastMoved->key;
+        node = successor(lastMoved);
+    }
+
+    if (node == nullptr) {
+        compactResumeKey_.reset();
+        compactRetired_.clear();
+        return true;
+    }
+
+    if (lastMoved != nullptr)
+        compactResumeKey_ = lastMoved->key;
+    return false;
 }
 
 // Traversals
@@ -175,27 +289,77 @@ void BSTBase<T, Node>::clear() {
 template <typename T, template <typename> class Node>
 template <class Container>
 Container BSTBase<T, Node>::inorder() const {
-    Container result(computeSize());
-    size_t currentIndex = 0;
-    subtreeInorder(root_.get(), result, currentIndex);
-    return result;
+    return collect<Container>(inorderRange());
 }
 
 template <typename T, template <typename> class Node>
 template <class Container>
 Container BSTBase<T, Node>::preorder() const {
-    Container result(computeSize());
-    size_t currentIndex = 0;
-    subtreePreorder(root_.get(), result, currentIndex);
-    return result;
+    return collect<Container>(preorderRange());
 }
 
 template <typename T, template <typename> class Node>
 template <class Container>
 Container BSTBase<T, Node>::postorder() const {
-    Container result(computeSize());
-    size_t currentIndex = 0;
-    subtreePostorder(root_.get(), result, currentIndex);
+    return collect<Container>(postorderRange());
+}
+
+template <typename T, template <typename> class Node>
+BSTTraversal<typename BSTBase<T, Node>::inorderIterator> BSTBase<T, Node>::inorderRange() const {
+    return BSTTraversal<inorderIterator>(inorderIterator(root_.get()));
+}
+
+template <typename T, template <typename> class Node>
+BSTTraversal<typename BSTBase<T, Node>::preorderIterator> BSTBase<T, Node>::preorderRange() const {
+    return BSTTraversal<preorderIterator>(preorderIterator(root_.get()));
+}
+
+template <typename T, template <typename> class Node>
+BSTTraversal<typename BSTBase<T, Node>::postorderIterator> BSTBase<T, Node>::postorderRange() const {
+    return BSTTraversal<postorderIterator>(postorderIterator(root_.get()));
+}
+
+template <typename T, template <typename> class Node>
+BSTTraversal<typename BSTBase<T, Node>::levelorderIterator> BSTBase<T, Node>::levelorderRange() const {
+    return BSTTraversal<levelorderIterator>(levelorderIterator(root_.get()));
+}
+
+// Calls function on every key, using threadCount threads (all hardware threads if 0).
+// Function is called concurrently for different keys, so it has to be thread safe.
+template <typename T, template <typename> class Node>
+template <class Function>
+void BSTBase<T, Node>::parallelForEach(Function function, size_t threadCount) const {
+    std::vector<TraversalSegment> segments = splitIntoSegments(threadCount);
+    auto task = [&](size_t index) {
+        segmentForEach(segments[index], function);
+    };
+    runParallel(segments.size(), threadCount, task);
+}
+
+// Folds the keys in inorder, using threadCount threads (all hardware threads if 0).
+// Every part of the tree starts with a copy of init and is folded with accumulate(Result, const T&) -> Result.
+// The partial results are then joined in key order with combine(Result, Result) -> Result, so combine only has to
+// be associative (not commutative) and init has to be its identity (e.g. 0 for a sum or an empty container).
+template <typename T, template <typename> class Node>
+template <class Result, class Accumulate, class Combine>
+Result BSTBase<T, Node>::parallelReduce(Result init, Accumulate accumulate, Combine combine, size_t threadCount) const {
+    std::vector<TraversalSegment> segments = splitIntoSegments(threadCount);
+    if (segments.empty())
+        return init;
+
+    std::vector<Result> partialResults(segments.size(), init);
+    auto task = [&](size_t index) {
+        Result& partialResult = partialResults[index];
+        auto function = [&](const T& key) {
+            partialResult = accumulate(std::move(partialResult), key);
+        };
+        segmentForEach(segments[index], function);
+    };
+    runParallel(segments.size(), threadCount, task);
+
+    Result result = std::move(partialResults[0]);
+    for (size_t i = 1; i < partialResults.size(); ++i)
+        result = combine(std::move(result), std::move(partialResults[i]));
     return result;
 }
 
@@ -214,11 +378,110 @@ size_t BSTBase<T, Node>::computeSize() const {
     return subtreeSize(root_.get());
 }
 
+template <typename T, template <typename> class Node>
+std::vector<size_t> BSTBase<T, Node>::computeDepthHistogram() const {  // histogram[d] is the number of nodes at depth d
+    std::vector<size_t> histogram;
+    subtreeDepthHistogram(root_.get(), 0, histogram);
+    return histogram;
+}
+
+#ifdef BST_ENABLE_STATS
+template <typename T, template <typename> class Node>
+const TreeStats& BSTBase<T, Node>::stats() const {
+    return stats_;
+}
+
+template <typename T, template <typename> class Node>
+void BSTBase<T, Node>::resetStats() {
+    stats_.reset();
+}
+#endif
+
 template <typename T, template <typename> class Node>
 typename BSTBase<T, Node>::iterator BSTBase<T, Node>::find(const T& key) const {
     return iterator(findNode(key));
 }
 
+// Looks up all keys and stores an iterator to each of them (or an invalid one) at the same index of result.
+// A group of searches is advanced one level at a time, and the next node of each search is prefetched
+// before moving on to the other searches, so the cache misses of the searches overlap.
+template <typename T, template <typename> class Node>
+template <class KeyContainer, class ItContainer>
+void BSTBase<T, Node>::findMany(const KeyContainer& keys, ItContainer& result) const {  // O(m * h)
+    result.resize(keys.size());
+
+    const T* slotKeys[findManyGroupSize];
+    size_t slotIndices[findManyGroupSize];
+    Node<T>* slotNodes[findManyGroupSize];
+    BST_STATS(size_t slotDepths[findManyGroupSize]);
+
+    auto keyIt = keys.begin();
+    size_t nextIndex = 0;
+    size_t activeSlots = 0;
+    while (activeSlots < findManyGroupSize && keyIt != keys.end()) {
+        slotKeys[activeSlots] = &*keyIt;
+        slotIndices[activeSlots] = nextIndex;
+        slotNodes[activeSlots] = root_.get();
+        BST_STATS(slotDepths[activeSlots] = 0);
+        ++keyIt;
+        ++nextIndex;
+        ++activeSlots;
+    }
+
+    while (activeSlots > 0) {
+        size_t i = 0;
+        while (i < activeSlots) {
+            Node<T>* node = slotNodes[i];
+            const T& key = *slotKeys[i];
+
+            if (node != nullptr && node->key != key) {
+                BST_STATS(++slotDepths[i]);
+                BST_STATS(stats_.comparisons += 2);  // != and >
+                node = node->key > key ? node->left.get() : node->right.get();
+                prefetch(node);
+                slotNodes[i] = node;
+                ++i;
+                continue;
+            }
+
+            // This search is done, so the slot starts the next one (or takes over the last active slot)
+            result[slotIndices[i]] = iterator(node);
+#ifdef BST_ENABLE_STATS
+            if (node != nullptr) {
+                ++slotDepths[i];
+                ++stats_.comparisons;
+            }
+            stats_.recordSearch(slotDepths[i]);
+#endif
+            if (keyIt != keys.end()) {
+                slotKeys[i] = &*keyIt;
+                slotIndices[i] = nextIndex;
+                slotNodes[i] = root_.get();
+                BST_STATS(slotDepths[i] = 0);
+                ++keyIt;
+                ++nextIndex;
+                ++i;
+            } else {
+                --activeSlots;
+                slotKeys[i] = slotKeys[activeSlots];
+                slotIndices[i] = slotIndices[activeSlots];
+                slotNodes[i] = slotNodes[activeSlots];
+                BST_STATS(slotDepths[i] = slotDepths[activeSlots]);
+            }
+        }
+    }
+}
+
+template <typename T, template <typename> class Node>
+size_t BSTBase<T, Node>::count(const T& key) const {  // O(h) for counted nodes, O(h + count) otherwise
+    if constexpr (IsCountedNode<Node, T>::value) {
+        Node<T>* keyNode = findNode(key);
+        return keyNode == nullptr ? 0 : keyNode->count;
+    } else {
+        return subtreeCount(root_.get(), key);
+    }
+}
+
 // Min / Max functions
 
 template <typename T, template <typename> class Node>
@@ -283,14 +546,24 @@ template <typename T, template <typename> class Node>
 Node<T>* BSTBase<T, Node>::insertAndReturnNewNode(const T& key) {
     Node<T>* it = root_.get();
     Node<T>* itParent = nullptr;
+    BST_STATS(++stats_.inserts);
 
     while (it != nullptr) {
         itParent = it;
 
-        if (it->key > key)
+        BST_STATS(++stats_.comparisons);
+        if (it->key > key) {
             it = it->left.get();
-        else
+        } else {
+            if constexpr (IsCountedNode<Node, T>::value) {
+                BST_STATS(++stats_.comparisons);
+                if (!(key > it->key)) {  // Equal key, so only count another copy
+                    ++it->count;
+                    return it;
+                }
+            }
             it = it->right.get();
+        }
     }
 
     if (itParent == nullptr) {
@@ -305,8 +578,26 @@ Node<T>* BSTBase<T, Node>::insertAndReturnNewNode(const T& key) {
     }
 }
 
+template <typename T, template <typename> class Node>
+bool BSTBase<T, Node>::decrementMultiplicity(Node<T>* node) {  // Returns true if copies of the key are left in node
+    if constexpr (IsCountedNode<Node, T>::value) {
+        if (node->count > 1) {
+            BST_STATS(++stats_.erases);
+            --node->count;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T, template <typename> class Node>
+size_t BSTBase<T, Node>::multiplicity(const Node<T>* node) const {
+    return nodeMultiplicity(node);
+}
+
 template <typename T, template <typename> class Node>
 void BSTBase<T, Node>::erase(Node<T>* toDelete) {
+    BST_STATS(++stats_.erases);
     if (toDelete->left == nullptr) {
         transplant(toDelete, toDelete->right);
     } else if (toDelete->right == nullptr) {
@@ -356,6 +647,7 @@ Node<T>* BSTBase<T, Node>::findReplacement(Node<T>* node) {
 
 template <typename T, template <typename> class Node>
 void BSTBase<T, Node>::rotateLeft(Node<T>* node) {
+    BST_STATS(++stats_.rotations);
     std::unique_ptr<Node<T>> rightChild = std::move(node->right);
     Node<T>* rightChildPtr = rightChild.get();
 
@@ -382,6 +674,7 @@ void BSTBase<T, Node>::rotateLeft(Node<T>* node) {
 
 template <typename T, template <typename> class Node>
 void BSTBase<T, Node>::rotateRight(Node<T>* node) {
+    BST_STATS(++stats_.rotations);
     std::unique_ptr<Node<T>> leftChild = std::move(node->left);
     Node<T>* leftChildPtr = leftChild.get();
 
@@ -409,14 +702,25 @@ void BSTBase<T, Node>::rotateRight(Node<T>* node) {
 template <typename T, template <typename> class Node>
 Node<T>* BSTBase<T, Node>::findNode(const T& key) const {  // O(h)
     Node<T>* it = root_.get();
+    BST_STATS(size_t depth = 0);
 
     while (it != nullptr && it->key != key) {
+        BST_STATS(++depth);
+        BST_STATS(stats_.comparisons += 2);  // != and >
         if (it->key > key)
             it = it->left.get();
         else
             it = it->right.get();
     }
 
+#ifdef BST_ENABLE_STATS
+    if (it != nullptr) {
+        ++depth;
+        ++stats_.comparisons;
+    }
+    stats_.recordSearch(depth);
+#endif
+
     return it;
 }
 
@@ -426,7 +730,7 @@ bool BSTBase<T, Node>::subtreeEqual(Node<T>* node, Node<T>* otherNode) const {
         return true;
     else if (node == nullptr && otherNode != nullptr || node != nullptr && otherNode == nullptr)
         return false;
-    else if (node->key != otherNode->key)
+    else if (node->key != otherNode->key || multiplicity(node) != multiplicity(otherNode))
         return false;
     else
         return subtreeEqual(node->left.get(), otherNode->left.get()) && subtreeEqual(node->right.get(), otherNode->right.get());
@@ -483,6 +787,13 @@ Node<T>* BSTBase<T, Node>::subtreeMax(Node<T>* subTreeRoot) const {  // O(h)
 
 // private utility
 
+template <typename T, template <typename> class Node>
+void BSTBase<T, Node>::prefetch(const Node<T>* node) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node);
+#endif
+}
+
 template <typename T, template <typename> class Node>
 size_t BSTBase<T, Node>::subtreeHeight(Node<T>* subtreeRoot) const {
     if (subtreeRoot == nullptr)
@@ -496,7 +807,78 @@ size_t BSTBase<T, Node>::subtreeSize(Node<T>* subtreeRoot) const {
     if (subtreeRoot == nullptr)
         return 0;
 
-    return subtreeSize(subtreeRoot->right.get()) + subtreeSize(subtreeRoot->left.get()) + 1;
+    return subtreeSize(subtreeRoot->right.get()) + subtreeSize(subtreeRoot->left.get()) + multiplicity(subtreeRoot);
+}
+
+template <typename T, template <typename> class Node>
+size_t BSTBase<T, Node>::subtreeCount(Node<T>* subtreeRoot, const T& key) const {
+    if (subtreeRoot == nullptr)
+        return 0;
+    else if (subtreeRoot->key > key)
+        return subtreeCount(subtreeRoot->left.get(), key);
+    else if (key > subtreeRoot->key)
+        return subtreeCount(subtreeRoot->right.get(), key);
+    else  // Rotations can move copies of the key into both subtrees
+        return subtreeCount(subtreeRoot->left.get(), key) + subtreeCount(subtreeRoot->right.get(), key) + 1;
+}
+
+template <typename T, template <typename> class Node>
+Node<T>* BSTBase<T, Node>::successor(Node<T>* node) const {  // O(h)
+    if (node->right != nullptr)
+        return subtreeMin(node->right.get());
+
+    while (node->parent != nullptr && node == node->parent->right.get())
+        node = node->parent;
+    return node->parent;
+}
+
+template <typename T, template <typename> class Node>
+Node<T>* BSTBase<T, Node>::firstNotLess(const T& key) const {  // O(h)
+    Node<T>* it = root_.get();
+    Node<T>* result = nullptr;
+
+    while (it != nullptr) {
+        if (!(key > it->key)) {
+            result = it;
+            it = it->left.get();
+        } else {
+            it = it->right.get();
+        }
+    }
+
+    return result;
+}
+
+template <typename T, template <typename> class Node>
+std::unique_ptr<Node<T>> BSTBase<T, Node>::relocate(Node<T>* node, std::unique_ptr<Node<T>>& newNode) {  // O(1)
+    Node<T>* newPtr = newNode.get();
+    std::unique_ptr<Node<T>>& position = getUnique(node);
+    std::unique_ptr<Node<T>> oldNode = std::move(position);
+    position = std::move(newNode);
+    newPtr->parent = node->parent;
+
+    newPtr->left = std::move(node->left);
+    if (newPtr->left != nullptr)
+        newPtr->left->parent = newPtr;
+
+    newPtr->right = std::move(node->right);
+    if (newPtr->right != nullptr)
+        newPtr->right->parent = newPtr;
+
+    return oldNode;
+}
+
+template <typename T, template <typename> class Node>
+void BSTBase<T, Node>::subtreeDepthHistogram(Node<T>* subtreeRoot, size_t depth, std::vector<size_t>& histogram) const {
+    if (subtreeRoot == nullptr)
+        return;
+
+    if (histogram.size() <= depth)
+        histogram.resize(depth + 1, 0);
+    ++histogram[depth];
+
+    subtreeDepthHistogram(subtreeRoot->left.get(), depth + 1, histogram);
+    subtreeDepthHistogram(subtreeRoot->right.get(), depth + 1, histogram);
 }
 
 template <typename T, template <typename> class Node>
@@ -516,34 +898,74 @@ std::unique_ptr<Node<T>> BSTBase<T, Node>::copySubtree(const Node<T>* subtreeRoo
 }
 
 template <typename T, template <typename> class Node>
-template <class Container>
-void BSTBase<T, Node>::subtreeInorder(Node<T>* subtreeRoot, Container& trav, size_t& currentIndex) const {
-    if (subtreeRoot != nullptr) {
-        subtreeInorder(subtreeRoot->left.get(), trav, currentIndex);
-        trav[currentIndex] = subtreeRoot->key;
+template <class Container, class Range>
+Container BSTBase<T, Node>::collect(const Range& range) const {
+    Container result(computeSize());
+    size_t currentIndex = 0;
+    for (const T& key : range) {
+        result[currentIndex] = key;
         ++currentIndex;
-        subtreeInorder(subtreeRoot->right.get(), trav, currentIndex);
     }
+    return result;
 }
 
+// Splits the tree into segments in key order: the subtrees at a depth that gives enough segments to balance the
+// work between the threads and the single nodes above them
 template <typename T, template <typename> class Node>
-template <class Container>
-void BSTBase<T, Node>::subtreePreorder(Node<T>* subtreeRoot, Container& trav, size_t& currentIndex) const {
-    if (subtreeRoot != nullptr) {
-        trav[currentIndex] = subtreeRoot->key;
-        ++currentIndex;
-        subtreePreorder(subtreeRoot->left.get(), trav, currentIndex);
-        subtreePreorder(subtreeRoot->right.get(), trav, currentIndex);
+std::vector<typename BSTBase<T, Node>::TraversalSegment> BSTBase<T, Node>::splitIntoSegments(size_t threadCount) const {
+    threadCount = resolveThreadCount(threadCount);
+
+    size_t depth = 0;
+    if (threadCount > 1) {
+        while ((size_t(1) << depth) < threadCount * segmentsPerThread)
+            ++depth;
     }
+
+    std::vector<TraversalSegment> segments;
+    subtreeSegments(root_.get(), depth, segments);
+    return segments;
 }
 
 template <typename T, template <typename> class Node>
-template <class Container>
-void BSTBase<T, Node>::subtreePostorder(Node<T>* subtreeRoot, Container& trav, size_t& currentIndex) const {
-    if (subtreeRoot != nullptr) {
-        subtreePostorder(subtreeRoot->left.get(), trav, currentIndex);
-        subtreePostorder(subtreeRoot->right.get(), trav, currentIndex);
-        trav[currentIndex] = subtreeRoot->key;
-        ++currentIndex;
+void BSTBase<T, Node>::subtreeSegments(const Node<T>* subtreeRoot, size_t depth, std::vector<TraversalSegment>& segments) const {
+    if (subtreeRoot == nullptr)
+        return;
+
+    if (depth == 0) {
+        segments.push_back({subtreeRoot, true});
+    } else {
+        subtreeSegments(subtreeRoot->left.get(), depth - 1, segments);
+        segments.push_back({subtreeRoot, false});
+        subtreeSegments(subtreeRoot->right.get(), depth - 1, segments);
+    }
+}
+
+template <typename T, template <typename> class Node>
+template <class Function>
+void BSTBase<T, Node>::segmentForEach(const TraversalSegment& segment, Function& function) const {  // Inorder using the parent pointers
+    const Node<T>* node = segment.node;
+    if (segment.wholeSubtree) {
+        while (node->left != nullptr)
+            node = node->left.get();
+    }
+
+    while (true) {
+        for (size_t i = 0; i < multiplicity(node); ++i)
+            function(node->key);
+
+        if (!segment.wholeSubtree)
+            return;
+
+        if (node->right != nullptr) {
+            node = node->right.get();
+            while (node->left != nullptr)
+                node = node->left.get();
+        } else {
+            while (node != segment.node && node == node->parent->right.get())
+                node = node->parent;
+            if (node == segment.node)
+                return;
+            node = node->parent;
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "TreeNode.h"
+
+enum class TraversalOrder {
+    INORDER,
+    PREORDER,
+    POSTORDER
+};
+
+// Iterator that walks the tree in the given order using the parent pointers of the nodes, so it needs O(1) memory.
+// Every copy of a key in a counted node is visited.
+template <typename T, template <typename> class Node, TraversalOrder Order>
+class BSTOrderIt {
+    const Node<T>* currentNode_;
+    size_t copy_;  // Index of the current copy of the key in currentNode_
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    BSTOrderIt() : currentNode_(nullptr), copy_(0) {}
+    explicit BSTOrderIt(const Node<T>* root);
+
+    BSTOrderIt<T, Node, Order>& operator++();
+    BSTOrderIt<T, Node, Order> operator++(int);
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    bool operator==(const BSTOrderIt<T, Node, Order>& other) const;
+    bool operator!=(const BSTOrderIt<T, Node, Order>& other) const;
+
+   private:
+    static const Node<T>* firstPostorder(const Node<T>* subtreeRoot);
+    static const Node<T>* next(const Node<T>* node);
+};
+
+// Level order needs to remember the nodes of the next level, so this iterator uses O(w) memory,
+// where w is the width of the tree
+template <typename T, template <typename> class Node>
+class BSTLevelOrderIt {
+    std::deque<const Node<T>*> queue_;
+    size_t copy_;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    BSTLevelOrderIt() : copy_(0) {}
+    explicit BSTLevelOrderIt(const Node<T>* root);
+
+    BSTLevelOrderIt<T, Node>& operator++();
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    bool operator==(const BSTLevelOrderIt<T, Node>& other) const;
+    bool operator!=(const BSTLevelOrderIt<T, Node>& other) const;
+};
+
+// Lazy range over a traversal, for use in range based for loops and algorithms
+template <class It>
+class BSTTraversal {
+    It begin_;
+
+   public:
+    explicit BSTTraversal(It begin) : begin_(std::move(begin)) {}
+
+    It begin() const {
+        return begin_;
+    }
+
+    It end() const {
+        return It();
+    }
+};
+
+// BSTOrderIt
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+BSTOrderIt<T, Node, Order>::BSTOrderIt(const Node<T>* root) : currentNode_(root), copy_(0) {
+    if (root == nullptr)
+        return;
+
+    if constexpr (Order == TraversalOrder::INORDER) {
+        while (currentNode_->left != nullptr)
+            currentNode_ = currentNode_->left.get();
+    } else if constexpr (Order == TraversalOrder::POSTORDER) {
+        currentNode_ = firstPostorder(root);
+    }
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+BSTOrderIt<T, Node, Order>& BSTOrderIt<T, Node, Order>::operator++() {
+    if (currentNode_ == nullptr)
+        throw std::runtime_error("Tried to increment invalid iterator");
+
+    ++copy_;
+    if (copy_ == nodeMultiplicity(currentNode_)) {
+        copy_ = 0;
+        currentNode_ = next(currentNode_);
+    }
+    return *this;
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+BSTOrderIt<T, Node, Order> BSTOrderIt<T, Node, Order>::operator++(int) {
+    BSTOrderIt<T, Node, Order> result = *this;
+    ++*this;
+    return result;
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+const T& BSTOrderIt<T, Node, Order>::operator*() const {
+    return currentNode_->key;
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+const T* BSTOrderIt<T, Node, Order>::operator->() const {
+    return &currentNode_->key;
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+bool BSTOrderIt<T, Node, Order>::operator==(const BSTOrderIt<T, Node, Order>& other) const {
+    return currentNode_ == other.currentNode_ && copy_ == other.copy_;
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+bool BSTOrderIt<T, Node, Order>::operator!=(const BSTOrderIt<T, Node, Order>& other) const {
+    return !(*this == other);
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+const Node<T>* BSTOrderIt<T, Node, Order>::firstPostorder(const Node<T>* subtreeRoot) {  // Deepest node on the leftmost path
+    const Node<T>* it = subtreeRoot;
+    while (it->left != nullptr || it->right != nullptr)
+        it = it->left != nullptr ? it->left.get() : it->right.get();
+    return it;
+}
+
+template <typename T, template <typename> class Node, TraversalOrder Order>
+const Node<T>* BSTOrderIt<T, Node, Order>::next(const Node<T>* node) {  // O(h) worst case, amortized O(1)
+    if constexpr (Order == TraversalOrder::INORDER) {
+        if (node->right != nullptr) {
+            node = node->right.get();
+            while (node->left != nullptr)
+                node = node->left.get();
+            return node;
+        }
+
+        while (node->parent != nullptr && node == node->parent->right.get())
+            node = node->parent;
+        return node->parent;
+    } else if constexpr (Order == TraversalOrder::PREORDER) {
+        if (node->left != nullptr)
+            return node->left.get();
+        if (node->right != nullptr)
+            return node->right.get();
+
+        // Go up until there is a right subtree that was not visited yet
+        while (node->parent != nullptr && (node == node->parent->right.get() || node->parent->right == nullptr))
+            node = node->parent;
+        return node->parent == nullptr ? nullptr : node->parent->right.get();
+    } else {
+        const Node<T>* parent = node->parent;
+        if (parent != nullptr && node == parent->left.get() && parent->right != nullptr)
+            return firstPostorder(parent->right.get());
+        return parent;
+    }
+}
+
+// BSTLevelOrderIt
+
+template <typename T, template <typename> class Node>
+BSTLevelOrderIt<T, Node>::BSTLevelOrderIt(const Node<T>* root) : copy_(0) {
+    if (root != nullptr)
+        queue_.push_back(root);
+}
+
+template <typename T, template <typename> class Node>
+BSTLevelOrderIt<T, Node>& BSTLevelOrderIt<T, Node>::operator++() {
+    if (queue_.empty())
+        throw std::runtime_error("Tried to increment invalid iterator");
+
+    const Node<T>* node = queue_.front();
+    ++copy_;
+    if (copy_ == nodeMultiplicity(node)) {
+        copy_ = 0;
+        queue_.pop_front();
+        if (node->left != nullptr)
+            queue_.push_back(node->left.get());
+        if (node->right != nullptr)
+            queue_.push_back(node->right.get());
+    }
+    return *this;
+}
+
+template <typename T, template <typename> class Node>
+const T& BSTLevelOrderIt<T, Node>::operator*() const {
+    return queue_.front()->key;
+}
+
+template <typename T, template <typename> class Node>
+const T* BSTLevelOrderIt<T, Node>::operator->() const {
+    return &queue_.front()->key;
+}
+
+template <typename T, template <typename> class Node>
+bool BSTLevelOrderIt<T, Node>::operator==(const BSTLevelOrderIt<T, Node>& other) const {
+    if (queue_.empty() || other.queue_.empty())
+        return queue_.empty() == other.queue_.empty();
+    return queue_.front() == other.queue_.front() && copy_ == other.copy_;
+}
+
+template <typename T, template <typename> class Node>
+bool BSTLevelOrderIt<T, Node>::operator!=(const BSTLevelOrderIt<T, Node>& other) const {
+    return !(*this == other);
+}
\ No newline at end of file
@@ -10,4 +10,20 @@ class BSTNode {
 };
 
 template <typename T>
-using BinarySearchTree = BSTBase<T, BSTNode>;
\ No newline at end of file
+using BinarySearchTree = BSTBase<T, BSTNode>;
+
+template <typename T>
+class BSTMultiNode {
+   public:
+    size_t count;
+    TreeNode(BSTMultiNode, T, count(1));
+    BSTMultiNode(const BSTMultiNode<T>& other) : BSTMultiNode<T>(other.key) {
+        count = other.count;
+    }
+    BSTMultiNode(BSTMultiNode<T>&& other) : BSTMultiNode<T>(std::move(other.key)) {
+        count = other.count;
+    }
+};
+
+template <typename T>
+using MultiBinarySearchTree = BSTBase<T, BSTMultiNode>;
\ No newline at end of file
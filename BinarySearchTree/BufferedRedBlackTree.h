@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "RedBlackTree.h"
+
+// Ordered container for insert-heavy workloads, that puts write buffers in front of a RedBlackTree.
+// New keys are appended to an unsorted buffer. A full buffer is sorted and merged into a list of sorted runs,
+// in which a run at index i holds up to batchSize * 2^i keys (like a binary counter). Once the runs hold as
+// many keys as the tree, everything is merged and the tree is rebuilt from the sorted keys in linear time.
+// Lookups search the unsorted buffer (at most batchSize keys), each run and the tree.
+template <typename T>
+class BufferedRedBlackTree {
+    RedBlackTree<T> tree_;
+    size_t treeSize_;
+
+    std::vector<std::vector<T>> runs_;  // runs_[i] is either empty or sorted
+    size_t runsSize_;
+
+    std::vector<T> pending_;
+    size_t batchSize_;
+
+   public:
+    explicit BufferedRedBlackTree(size_t batchSize = 256);
+
+    void insert(const T& key);  // amortized O(log(n / batchSize)) without comparisons in the tree
+
+    void erase(const T& key);
+
+    void flush();
+    void clear();
+
+    bool contains(const T& key) const;
+    size_t count(const T& key) const;
+
+    template <class Container>
+    Container inorder() const;
+
+    bool isEmpty() const;
+    size_t size() const;
+
+    const RedBlackTree<T>& tree();
+
+   private:
+    void sortPending();
+    void mergeIntoTree();
+
+    std::vector<T> sortedKeys() const;
+
+    static std::vector<T> mergeRuns(std::vector<T>&& first, std::vector<T>&& second);
+};
+
+// Constructors
+
+template <typename T>
+BufferedRedBlackTree<T>::BufferedRedBlackTree(size_t batchSize) : treeSize_(0), runsSize_(0), batchSize_(std::max<size_t>(batchSize, 1)) {
+    pending_.reserve(batchSize_);
+}
+
+// Insertion and deletion functions
+
+template <typename T>
+void BufferedRedBlackTree<T>::insert(const T& key) {
+    pending_.push_back(key);
+    if (pending_.size() >= batchSize_)
+        sortPending();
+}
+
+template <typename T>
+void BufferedRedBlackTree<T>::erase(const T& key) {  // O(batchSize + log(n)^2 + r), r is the size of the run holding key, up to n
+    auto pendingIt = std::find(pending_.begin(), pending_.end(), key);
+    if (pendingIt != pending_.end()) {
+        *pendingIt = std::move(pending_.back());
+        pending_.pop_back();
+        return;
+    }
+
+    for (std::vector<T>& run : runs_) {
+        auto runIt = std::lower_bound(run.begin(), run.end(), key);
+        if (runIt != run.end() && *runIt == key) {
+            run.erase(runIt);
+            --runsSize_;
+            return;
+        }
+    }
+
+    auto treeIt = tree_.find(key);
+    if (treeIt.isValid()) {
+        tree_.erase(treeIt);
+        --treeSize_;
+    }
+}
+
+// Moves all buffered keys into the tree
+template <typename T>
+void BufferedRedBlackTree<T>::flush() {
+    if (!pending_.empty() || runsSize_ != 0)
+        mergeIntoTree();
+}
+
+template <typename T>
+void BufferedRedBlackTree<T>::clear() {
+    tree_.clear();
+    treeSize_ = 0;
+    runs_.clear();
+    runsSize_ = 0;
+    pending_.clear();
+}
+
+// Lookup functions
+
+template <typename T>
+bool BufferedRedBlackTree<T>::contains(const T& key) const {
+    if (std::find(pending_.begin(), pending_.end(), key) != pending_.end())
+        return true;
+
+    for (const std::vector<T>& run : runs_) {
+        if (std::binary_search(run.begin(), run.end(), key))
+            return true;
+    }
+
+    return tree_.find(key).isValid();
+}
+
+template <typename T>
+size_t BufferedRedBlackTree<T>::count(const T& key) const {
+    size_t result = std::count(pending_.begin(), pending_.end(), key);
+
+    for (const std::vector<T>& run : runs_) {
+        auto range = std::equal_range(run.begin(), run.end(), key);
+        result += range.second - range.first;
+    }
+
+    return result + tree_.count(key);
+}
+
+template <typename T>
+template <class Container>
+Container BufferedRedBlackTree<T>::inorder() const {
+    std::vector<T> keys = sortedKeys();
+
+    Container result(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+        result[i] = std::move(keys[i]);
+    return result;
+}
+
+template <typename T>
+bool BufferedRedBlackTree<T>::isEmpty() const {
+    return size() == 0;
+}
+
+template <typename T>
+size_t BufferedRedBlackTree<T>::size() const {
+    return treeSize_ + runsSize_ + pending_.size();
+}
+
+// Flushes the buffers, so the tree holds all keys
+template <typename T>
+const RedBlackTree<T>& BufferedRedBlackTree<T>::tree() {
+    flush();
+    return tree_;
+}
+
+// private utility
+
+template <typename T>
+void BufferedRedBlackTree<T>::sortPending() {
+    std::sort(pending_.begin(), pending_.end());
+    runsSize_ += pending_.size();
+
+    std::vector<T> carry = std::move(pending_);
+    pending_ = std::vector<T>();
+    pending_.reserve(batchSize_);
+
+    size_t level = 0;
+    while (level < runs_.size() && !runs_[level].empty()) {
+        carry = mergeRuns(std::move(runs_[level]), std::move(carry));
+        runs_[level] = std::vector<T>();
+        ++level;
+    }
+
+    if (level == runs_.size())
+        runs_.push_back(std::move(carry));
+    else
+        runs_[level] = std::move(carry);
+
+    if (runsSize_ >= treeSize_)
+        mergeIntoTree();
+}
+
+template <typename T>
+void BufferedRedBlackTree<T>::mergeIntoTree() {  // O(n)
+    std::sort(pending_.begin(), pending_.end());
+    std::vector<T> buffered = std::move(pending_);
+    for (std::vector<T>& run : runs_)  // Smallest runs first
+        buffered = mergeRuns(std::move(buffered), std::move(run));
+
+    std::vector<T> keys = mergeRuns(tree_.template inorder<std::vector<T>>(), std::move(buffered));
+    tree_.assignSorted(keys.begin(), keys.end());
+    treeSize_ = keys.size();
+
+    runs_.clear();
+    runsSize_ = 0;
+    pending_ = std::vector<T>();
+    pending_.reserve(batchSize_);
+}
+
+template <typename T>
+std::vector<T> BufferedRedBlackTree<T>::sortedKeys() const {
+    std::vector<T> buffered = pending_;
+    std::sort(buffered.begin(), buffered.end());
+    for (const std::vector<T>& run : runs_)
+        buffered = mergeRuns(std::move(buffered), std::vector<T>(run));
+
+    return mergeRuns(tree_.template inorder<std::vector<T>>(), std::move(buffered));
+}
+
+template <typename T>
+std::vector<T> BufferedRedBlackTree<T>::mergeRuns(std::vector<T>&& first, std::vector<T>&& second) {
+    std::vector<T> result;
+    result.reserve(first.size() + second.size());
+    std::merge(std::make_move_iterator(first.begin()), std::make_move_iterator(first.end()),
+               std::make_move_iterator(second.begin()), std::make_move_iterator(second.end()),
+               std::back_inserter(result));
+    return result;
+}
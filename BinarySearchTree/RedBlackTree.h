@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cmath>
+
 #include "BSTBase.h"
 
 #include "TreeNode.h"
@@ -17,24 +19,47 @@ class RBTreeNode {
     RBTreeNode(const RBTreeNode<T>& other) : RBTreeNode<T>(other.key) {
         color = other.color;
     }
+    RBTreeNode(RBTreeNode<T>&& other) : RBTreeNode<T>(std::move(other.key)) {
+        color = other.color;
+    }
 };
 
 template <typename T>
-using RBTreeBase = BSTBase<T, RBTreeNode>;
-
-template <typename T>
-class RedBlackTree : public RBTreeBase<T> {
+class RBMultiTreeNode {
    public:
-    using iterator = typename RBTreeBase<T>::iterator;
     using Color = typename RBTreeNode<T>::Color;
-    RedBlackTree() : RBTreeBase<T>() {}
-    RedBlackTree(const RedBlackTree<T>& other) : RBTreeBase<T>(other) {}
-    RedBlackTree(RedBlackTree<T>&& other) : RBTreeBase<T>(std::move(other)) {}
 
-    RedBlackTree<T>& operator=(const RedBlackTree<T>& other);
-    RedBlackTree<T>& operator=(RedBlackTree<T>&& other);
+    Color color;
+    size_t count;
+    TreeNode(RBMultiTreeNode, T, color(Color::RED), count(1));
+    RBMultiTreeNode(const RBMultiTreeNode<T>& other) : RBMultiTreeNode<T>(other.key) {
+        color = other.color;
+        count = other.count;
+    }
+    RBMultiTreeNode(RBMultiTreeNode<T>&& other) : RBMultiTreeNode<T>(std::move(other.key)) {
+        color = other.color;
+        count = other.count;
+    }
+};
+
+template <typename T, template <typename> class Node = RBTreeNode>
+using RBTreeBase = BSTBase<T, Node>;
+
+template <typename T, template <typename> class Node = RBTreeNode>
+class RedBlackTree : public RBTreeBase<T, Node> {
+   public:
+    using iterator = typename RBTreeBase<T, Node>::iterator;
+    using Color = typename Node<T>::Color;
+    RedBlackTree() : RBTreeBase<T, Node>() {}
+    RedBlackTree(const RedBlackTree<T, Node>& other) : RBTreeBase<T, Node>(other) {}
+    RedBlackTree(RedBlackTree<T, Node>&& other) : RBTreeBase<T, Node>(std::move(other)) {}
+
+    RedBlackTree<T, Node>& operator=(const RedBlackTree<T, Node>& other);
+    RedBlackTree<T, Node>& operator=(RedBlackTree<T, Node>&& other);
 
     void insert(const T& key);
+    template <class RandomIt>
+    void assignSorted(RandomIt first, RandomIt last);
 
     void erase(const T& key);
     void erase(iterator& it);
@@ -44,59 +69,104 @@ class RedBlackTree : public RBTreeBase<T> {
     T extractMax();
 
    protected:
-    using RBTreeBase<T>::rotateLeft;
-    using RBTreeBase<T>::rotateRight;
+    using RBTreeBase<T, Node>::rotateLeft;
+    using RBTreeBase<T, Node>::rotateRight;
 
    private:
-    void erase(RBTreeNode<T>* node);
+    template <class RandomIt, class MakeNode>
+    std::unique_ptr<Node<T>> buildSubtree(RandomIt first, RandomIt last, size_t depth, size_t redDepth, MakeNode& makeNode);
 
-    void fixColorsAfterInsertion(RBTreeNode<T>* node);
-    void fixDoubleBlack(RBTreeNode<T>* node);
+    void erase(Node<T>* node);
+
+    void fixColorsAfterInsertion(Node<T>* node);
+    void fixDoubleBlack(Node<T>* node, Node<T>* parent);
+
+    void setColor(Node<T>* node, Color color);  // Counts the recoloring if the color actually changes
+    static bool isBlack(const Node<T>* node);
 };
 
+template <typename T>
+using MultiRedBlackTree = RedBlackTree<T, RBMultiTreeNode>;
+
 // Assignment operators
 
-template <typename T>
-RedBlackTree<T>& RedBlackTree<T>::operator=(const RedBlackTree<T>& other) {
-    RBTreeBase<T>::operator=(other);
+template <typename T, template <typename> class Node>
+RedBlackTree<T, Node>& RedBlackTree<T, Node>::operator=(const RedBlackTree<T, Node>& other) {
+    RBTreeBase<T, Node>::operator=(other);
     return *this;
 }
 
-template <typename T>
-RedBlackTree<T>& RedBlackTree<T>::operator=(RedBlackTree<T>&& other) {
-    RBTreeBase<T>::operator=(std::move(other));
+template <typename T, template <typename> class Node>
+RedBlackTree<T, Node>& RedBlackTree<T, Node>::operator=(RedBlackTree<T, Node>&& other) {
+    RBTreeBase<T, Node>::operator=(std::move(other));
     return *this;
 }
 
 // Insertion operation
 
-template <typename T>
-void RedBlackTree<T>::insert(const T& key) {
-    RBTreeNode<T>* insertedNode = RBTreeBase<T>::insertAndReturnNewNode(key);
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::insert(const T& key) {
+    Node<T>* insertedNode = RBTreeBase<T, Node>::insertAndReturnNewNode(key);
+
+    if (this->multiplicity(insertedNode) == 1)  // Otherwise only the count of an existing node was incremented
+        fixColorsAfterInsertion(insertedNode);
+}
 
-    fixColorsAfterInsertion(insertedNode);
+// Replaces the contents of the tree with the keys in [first, last), which must be sorted in ascending order.
+// The tree is built bottom up without any comparisons or rotations
+template <typename T, template <typename> class Node>
+template <class RandomIt>
+void RedBlackTree<T, Node>::assignSorted(RandomIt first, RandomIt last) {  // O(n)
+    this->clear();
+    if (first == last)
+        return;
+
+    if constexpr (IsCountedNode<Node, T>::value) {
+        // Equal keys are stored in one node, so build the tree from the runs of equal keys
+        std::vector<std::pair<RandomIt, size_t>> runs;
+        for (RandomIt it = first; it != last; ++it) {
+            if (runs.empty() || *runs.back().first != *it)
+                runs.emplace_back(it, 1);
+            else
+                ++runs.back().second;
+        }
+
+        auto makeNode = [](const std::pair<RandomIt, size_t>& run) {
+            auto node = std::make_unique<Node<T>>(*run.first);
+            node->count = run.second;
+            return node;
+        };
+        size_t redDepth = static_cast<size_t>(std::log2(runs.size()));
+        this->root_ = buildSubtree(runs.begin(), runs.end(), 0, redDepth, makeNode);
+    } else {
+        auto makeNode = [](const T& key) {
+            return std::make_unique<Node<T>>(key);
+        };
+        size_t redDepth = static_cast<size_t>(std::log2(last - first));
+        this->root_ = buildSubtree(first, last, 0, redDepth, makeNode);
+    }
 }
 
 // Deletion operations
 
-template <typename T>
-void RedBlackTree<T>::erase(const T& key) {
-    RBTreeNode<T>* nodeToDelete = this->findNode(key);
-    if (nodeToDelete != nullptr)
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::erase(const T& key) {
+    Node<T>* nodeToDelete = this->findNode(key);
+    if (nodeToDelete != nullptr && !this->decrementMultiplicity(nodeToDelete))
         erase(nodeToDelete);
 }
 
-template <typename T>
-void RedBlackTree<T>::erase(iterator& it) {
-    if (this->getPtr(it) != nullptr) {
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::erase(iterator& it) {
+    if (this->getPtr(it) != nullptr && !this->decrementMultiplicity(this->getPtr(it))) {
         erase(this->getPtr(it));
         it.invalidate();
     }
 }
 
-template <typename T>
-void RedBlackTree<T>::erase(iterator&& it) {
-    if (this->getPtr(it) != nullptr) {
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::erase(iterator&& it) {
+    if (this->getPtr(it) != nullptr && !this->decrementMultiplicity(this->getPtr(it))) {
         erase(this->getPtr(it));
         it.invalidate();
     }
@@ -104,16 +174,16 @@ void RedBlackTree<T>::erase(iterator&& it) {
 
 // Extract Min / Max
 
-template <typename T>
-T RedBlackTree<T>::extractMin() {
+template <typename T, template <typename> class Node>
+T RedBlackTree<T, Node>::extractMin() {
     iterator minIt = this->min();
     T key = minIt.key();
     erase(minIt);
     return key;
 }
 
-template <typename T>
-T RedBlackTree<T>::extractMax() {
+template <typename T, template <typename> class Node>
+T RedBlackTree<T, Node>::extractMax() {
     iterator maxIt = this->max();
     T key = maxIt.key();
     erase(maxIt);
@@ -122,64 +192,82 @@ T RedBlackTree<T>::extractMax() {
 
 // private Utility
 
-template <typename T>
-void RedBlackTree<T>::erase(RBTreeNode<T>* toDelete) {
-    RBTreeNode<T>* replacement = this->findReplacement(toDelete);
-    bool bothBlack = (replacement == nullptr || replacement->color == Color::BLACK) && (toDelete->color == Color::BLACK);
+// Splitting at the middle puts every missing child at depth redDepth or redDepth + 1, where redDepth = floor(log2(n))
+// is the depth of the deepest level. Making only the nodes on that level red leaves redDepth black nodes on every path.
+template <typename T, template <typename> class Node>
+template <class RandomIt, class MakeNode>
+std::unique_ptr<Node<T>> RedBlackTree<T, Node>::buildSubtree(RandomIt first, RandomIt last, size_t depth, size_t redDepth, MakeNode& makeNode) {
+    if (first == last)
+        return nullptr;
 
-    RBTreeNode<T>* parent = toDelete->parent;
+    RandomIt middle = first + (last - first) / 2;
+    std::unique_ptr<Node<T>> node = makeNode(*middle);
+    node->color = depth == redDepth && depth != 0 ? Color::RED : Color::BLACK;
 
-    if (replacement == nullptr) {
-        if (toDelete == this->root_.get()) {
-           this->root_ = nullptr;
-        } else {
-            if (bothBlack) {
-               fixDoubleBlack(toDelete);
-            } else {
-                if (toDelete == toDelete->parent->left.get() && toDelete->parent->right != nullptr) {
-                    toDelete->parent->right->color = Color::RED;
-                } else if (toDelete == toDelete->parent->right.get() && toDelete->parent->left != nullptr) {
-                    toDelete->parent->left->color = Color::RED;
-                }
-            }
+    node->left = buildSubtree(first, middle, depth + 1, redDepth, makeNode);
+    if (node->left != nullptr)
+        node->left->parent = node.get();
 
-            if (toDelete == parent->left.get())
-                parent->left = nullptr;
-            else
-                parent->right = nullptr;
-        }
-    } else if (toDelete->left == nullptr || toDelete->right == nullptr) {
-        // Because toDelete has only one child, that child must be replacement
-        if (toDelete == this->root_.get()) {
-           toDelete->key = replacement->key;
-           toDelete->left =  nullptr;
-           toDelete->right = nullptr;
-        } else {
-            bool isLeft = toDelete == toDelete->parent->left.get();
+    node->right = buildSubtree(middle + 1, last, depth + 1, redDepth, makeNode);
+    if (node->right != nullptr)
+        node->right->parent = node.get();
 
-            if (isLeft)
-               parent->left = std::move(this->getUnique(replacement));
-            else
-                parent->right = std::move(this->getUnique(replacement));
-            
-            replacement->parent = parent;
+    return node;
+}
 
-            if (bothBlack)
-                fixDoubleBlack(replacement);
-            else
-                replacement->color = Color::BLACK;
-        }
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::erase(Node<T>* toDelete) {  // O(h), nodes are only relinked, so keys never move
+    BST_STATS(++this->stats_.erases);
+
+    Color removedColor = toDelete->color;
+    Node<T>* child;  // Takes the place of the node that is removed from its position (may be nullptr)
+    Node<T>* childParent;
+
+    if (toDelete->left == nullptr || toDelete->right == nullptr) {
+        std::unique_ptr<Node<T>>& onlyChild = toDelete->left != nullptr ? toDelete->left : toDelete->right;
+        child = onlyChild.get();
+        childParent = toDelete->parent;
+        this->transplant(toDelete, onlyChild);
     } else {
-        std::swap(toDelete->key, replacement->key);
-        erase(replacement);
+        Node<T>* replacement = this->subtreeMin(toDelete->right.get());
+        removedColor = replacement->color;
+        child = replacement->right.get();
+
+        setColor(replacement, toDelete->color);
+
+        if (replacement->parent != toDelete) {
+            childParent = replacement->parent;
+
+            std::unique_ptr<Node<T>> tmp = std::move(childParent->left);  // replacement is the left child of its parent
+            childParent->left = std::move(tmp->right);
+            if (child != nullptr)
+                child->parent = childParent;
+
+            tmp->right = std::move(toDelete->right);
+            tmp->right->parent = replacement;
+
+            tmp->left = std::move(toDelete->left);
+            tmp->left->parent = replacement;
+
+            this->transplant(toDelete, tmp);
+        } else {
+            childParent = replacement;
+
+            replacement->left = std::move(toDelete->left);
+            replacement->left->parent = replacement;
+            this->transplant(toDelete, toDelete->right);
+        }
     }
+
+    if (removedColor == Color::BLACK)
+        fixDoubleBlack(child, childParent);
 }
 
-template <typename T>
-void RedBlackTree<T>::fixColorsAfterInsertion(RBTreeNode<T>* node) {
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::fixColorsAfterInsertion(Node<T>* node) {
     while (node->parent != nullptr && node->parent->color == Color::RED) {
         bool parentIsLeftChild;
-        RBTreeNode<T>* parentSibling;
+        Node<T>* parentSibling;
         if (node->parent == node->parent->parent->left.get()) {
             parentSibling = node->parent->parent->right.get();
             parentIsLeftChild = true;
@@ -189,9 +277,9 @@ void RedBlackTree<T>::fixColorsAfterInsertion(RBTreeNode<T>* node) {
         }
 
         if (parentSibling != nullptr && parentSibling->color == Color::RED) {
-            node->parent->color = Color::BLACK;
-            parentSibling->color = Color::BLACK;
-            node->parent->parent->color = Color::RED;
+            setColor(node->parent, Color::BLACK);
+            setColor(parentSibling, Color::BLACK);
+            setColor(node->parent->parent, Color::RED);
 
             node = node->parent->parent;
         } else {
@@ -202,8 +290,8 @@ void RedBlackTree<T>::fixColorsAfterInsertion(RBTreeNode<T>* node) {
                 node = node->parent;
                 rotateRight(node);
             }
-            node->parent->color = Color::BLACK;
-            node->parent->parent->color = Color::RED;
+            setColor(node->parent, Color::BLACK);
+            setColor(node->parent->parent, Color::RED);
 
             if (parentIsLeftChild)
                 rotateRight(node->parent->parent);
@@ -211,64 +299,81 @@ void RedBlackTree<T>::fixColorsAfterInsertion(RBTreeNode<T>* node) {
                 rotateLeft(node->parent->parent);
         }
     }
-    this->root_->color = Color::BLACK;
+    setColor(this->root_.get(), Color::BLACK);
 }
 
-template <typename T>
-void RedBlackTree<T>::fixDoubleBlack(RBTreeNode<T>* node) {
-    while (node != this->root_.get()) {
-        RBTreeNode<T>* parent = node->parent;
+// node carries an extra black. It may be nullptr, which is why its parent is passed separately
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::fixDoubleBlack(Node<T>* node, Node<T>* parent) {
+    while (node != this->root_.get() && isBlack(node)) {
+        if (node == parent->left.get()) {
+            Node<T>* sibling = parent->right.get();
+            if (sibling->color == Color::RED) {
+                setColor(sibling, Color::BLACK);
+                setColor(parent, Color::RED);
+                rotateLeft(parent);
+                sibling = parent->right.get();
+            }
+
+            if (isBlack(sibling->left.get()) && isBlack(sibling->right.get())) {
+                setColor(sibling, Color::RED);
+                node = parent;
+                parent = node->parent;
+            } else {
+                if (isBlack(sibling->right.get())) {
+                    setColor(sibling->left.get(), Color::BLACK);
+                    setColor(sibling, Color::RED);
+                    rotateRight(sibling);
+                    sibling = parent->right.get();
+                }
 
-        if ((node == parent->left.get() && parent->right == nullptr) || 
-            (node == parent->right.get() && parent->left == nullptr)) {
-            node = parent;
+                setColor(sibling, parent->color);
+                setColor(parent, Color::BLACK);
+                setColor(sibling->right.get(), Color::BLACK);
+                rotateLeft(parent);
+                node = this->root_.get();
+            }
         } else {
-            RBTreeNode<T>* sibling = node == parent->left.get() ? parent->right.get() : parent->left.get();
+            Node<T>* sibling = parent->left.get();
             if (sibling->color == Color::RED) {
-                parent->color = Color::RED;
-                sibling->color = Color::BLACK;
+                setColor(sibling, Color::BLACK);
+                setColor(parent, Color::RED);
+                rotateRight(parent);
+                sibling = parent->left.get();
+            }
 
-                if (sibling == parent->left.get())
-                    this->rotateRight(parent);
-                else
-                    this->rotateLeft(parent);
+            if (isBlack(sibling->left.get()) && isBlack(sibling->right.get())) {
+                setColor(sibling, Color::RED);
+                node = parent;
+                parent = node->parent;
             } else {
-                if ((sibling->left != nullptr && sibling->left->color == Color::RED) || 
-                    (sibling->right != nullptr && sibling->right->color == Color::RED)) {
-                
-                    if (sibling->left != nullptr && sibling->left->color == Color::RED) {
-                        if (sibling == sibling->parent->left.get()) {
-                            sibling->left->color = sibling->color;
-                            sibling->color = parent->color;
-                            this->rotateRight(parent);
-                        } else {
-                            sibling->left->color = parent->color;
-                            this->rotateRight(sibling);
-                            this->rotateLeft(parent);
-                        }
-                    } else {
-                        if (sibling == sibling->parent->left.get()) {
-                            sibling->right->color = parent->color;
-                            this->rotateLeft(sibling);
-                            this->rotateRight(parent);
-                        } else {
-                            sibling->right->color = sibling->color;
-                            sibling->color = parent->color;
-                            this->rotateLeft(parent);
-                        }
-                    }
-                    parent->color = Color::BLACK;
-                    break;
-                } else {
-                    sibling->color = Color::RED;
-                    if (parent->color = Color::BLACK)
-                        node = parent;
-                    else {
-                        parent->color = Color::BLACK;
-                        break;
-                    }
+                if (isBlack(sibling->left.get())) {
+                    setColor(sibling->right.get(), Color::BLACK);
+                    setColor(sibling, Color::RED);
+                    rotateLeft(sibling);
+                    sibling = parent->left.get();
                 }
+
+                setColor(sibling, parent->color);
+                setColor(parent, Color::BLACK);
+                setColor(sibling->left.get(), Color::BLACK);
+                rotateRight(parent);
+                node = this->root_.get();
             }
         }
     }
+
+    if (node != nullptr)
+        setColor(node, Color::BLACK);
+}
+
+template <typename T, template <typename> class Node>
+bool RedBlackTree<T, Node>::isBlack(const Node<T>* node) {  // nullptr counts as a black leaf
+    return node == nullptr || node->color == Color::BLACK;
+}
+
+template <typename T, template <typename> class Node>
+void RedBlackTree<T, Node>::setColor(Node<T>* node, Color color) {
+    BST_STATS(this->stats_.recolorings += node->color != color);
+    node->color = color;
 }
\ No newline at end of file
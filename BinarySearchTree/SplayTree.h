@@ -1,18 +1,18 @@
 #include "BinarySearchTree.h"
 
-template <typename T>
-class SplayTree : public BinarySearchTree<T> {
+template <typename T, template <typename> class Node = BSTNode>
+class SplayTree : public BSTBase<T, Node> {
    public:
-    using iterator = typename BinarySearchTree<T>::iterator;
+    using iterator = typename BSTBase<T, Node>::iterator;
 
-    SplayTree() : BinarySearchTree<T>() {}
-    SplayTree(const SplayTree<T>& tree) : BinarySearchTree<T>(tree) {}
-    SplayTree(const BinarySearchTree<T>& tree) : BinarySearchTree<T>(tree) {}
-    SplayTree(SplayTree<T>&& tree) : BinarySearchTree<T>(std::move(tree)) {}
-    SplayTree(BinarySearchTree<T>&& tree) : BinarySearchTree<T>(std::move(tree)) {}
+    SplayTree() : BSTBase<T, Node>() {}
+    SplayTree(const SplayTree<T, Node>& tree) : BSTBase<T, Node>(tree) {}
+    SplayTree(const BSTBase<T, Node>& tree) : BSTBase<T, Node>(tree) {}
+    SplayTree(SplayTree<T, Node>&& tree) : BSTBase<T, Node>(std::move(tree)) {}
+    SplayTree(BSTBase<T, Node>&& tree) : BSTBase<T, Node>(std::move(tree)) {}
 
-    SplayTree<T>& operator=(const SplayTree<T>& tree);
-    SplayTree<T>& operator=(SplayTree<T>&& tree);
+    SplayTree<T, Node>& operator=(const SplayTree<T, Node>& tree);
+    SplayTree<T, Node>& operator=(SplayTree<T, Node>&& tree);
 
     void insert(const T& key);
 
@@ -23,61 +23,64 @@ class SplayTree : public BinarySearchTree<T> {
     iterator find(const T& key);
 
    private:
-    void erase(BSTNode<T>* node);
+    void erase(Node<T>* node);
 
-    void splay(BSTNode<T>* node);
+    void splay(Node<T>* node);
 
-    void splayUpTo(BSTNode<T>* node, BSTNode<T>* newParent);
+    void splayUpTo(Node<T>* node, Node<T>* newParent);
 
-    void zigZig(BSTNode<T>* node);
-    void zigZag(BSTNode<T>* node);
+    void zigZig(Node<T>* node);
+    void zigZag(Node<T>* node);
 
-    void zig(BSTNode<T>* node);
+    void zig(Node<T>* node);
 };
 
+template <typename T>
+using MultiSplayTree = SplayTree<T, BSTMultiNode>;
+
 // Assignment operators
 
-template <typename T>
-SplayTree<T>& SplayTree<T>::operator=(const SplayTree<T>& tree) {
-    BinarySearchTree<T>::operator=(tree);
+template <typename T, template <typename> class Node>
+SplayTree<T, Node>& SplayTree<T, Node>::operator=(const SplayTree<T, Node>& tree) {
+    BSTBase<T, Node>::operator=(tree);
     return *this;
 }
 
-template <typename T>
-SplayTree<T>& SplayTree<T>::operator=(SplayTree<T>&& tree) {
-    BinarySearchTree<T>::operator=(std::move(tree));
+template <typename T, template <typename> class Node>
+SplayTree<T, Node>& SplayTree<T, Node>::operator=(SplayTree<T, Node>&& tree) {
+    BSTBase<T, Node>::operator=(std::move(tree));
     return *this;
 }
 
 // Insertion operation
 
-template <typename T>
-void SplayTree<T>::insert(const T& key) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::insert(const T& key) {
     splay(this->insertAndReturnNewNode(key));
 }
 
 // Delete operation
 
-template <typename T>
-void SplayTree<T>::erase(const T& key) {
-    BSTNode<T>* keyNode = this->findNode(key);
-    if (keyNode != nullptr)
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::erase(const T& key) {
+    Node<T>* keyNode = this->findNode(key);
+    if (keyNode != nullptr && !this->decrementMultiplicity(keyNode))
         erase(keyNode);
 }
 
-template <typename T>
-void SplayTree<T>::erase(iterator& it) {
-    BSTNode<T>* itNode = this->getPtr(it);
-    if (itNode != nullptr) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::erase(iterator& it) {
+    Node<T>* itNode = this->getPtr(it);
+    if (itNode != nullptr && !this->decrementMultiplicity(itNode)) {
         erase(itNode);
         it.invalidate();
     }
 }
 
-template <typename T>
-void SplayTree<T>::erase(iterator&& it) {
-    BSTNode<T>* itNode = this->getPtr(it);
-    if (itNode != nullptr) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::erase(iterator&& it) {
+    Node<T>* itNode = this->getPtr(it);
+    if (itNode != nullptr && !this->decrementMultiplicity(itNode)) {
         erase(itNode);
         it.invalidate();
     }
@@ -85,16 +88,17 @@ void SplayTree<T>::erase(iterator&& it) {
 
 // Search operation
 
-template <typename T>
-typename SplayTree<T>::iterator SplayTree<T>::find(const T& key) {
-    BSTNode<T>* keyNode = this->findNode(key);
+template <typename T, template <typename> class Node>
+typename SplayTree<T, Node>::iterator SplayTree<T, Node>::find(const T& key) {
+    Node<T>* keyNode = this->findNode(key);
     if (keyNode != nullptr)
         splay(keyNode);
     return iterator(keyNode);
 }
 
-template <typename T>
-void SplayTree<T>::erase(BSTNode<T>* node) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::erase(Node<T>* node) {
+    BST_STATS(++this->stats_.erases);
     splay(node);
 
     if (node->left == nullptr) {
@@ -102,7 +106,7 @@ void SplayTree<T>::erase(BSTNode<T>* node) {
     } else if (node->right == nullptr) {
         this->transplant(node, node->left);
     } else {
-        BSTNode<T>* leftMax = this->subtreeMax(node->left.get());
+        Node<T>* leftMax = this->subtreeMax(node->left.get());
         splayUpTo(leftMax, node);
         leftMax->right = std::move(node->right);
         leftMax->right->parent = leftMax;
@@ -112,14 +116,15 @@ void SplayTree<T>::erase(BSTNode<T>* node) {
 
 // Splay operations and helpers
 
-template <typename T>
-void SplayTree<T>::splay(BSTNode<T>* node) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::splay(Node<T>* node) {
     splayUpTo(node, nullptr);
 }
 
-template <typename T>
-void SplayTree<T>::splayUpTo(BSTNode<T>* node, BSTNode<T>* newParent) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::splayUpTo(Node<T>* node, Node<T>* newParent) {
     while (node->parent != newParent) {
+        BST_STATS(++this->stats_.splaySteps);
         if (node->parent->parent == newParent)
             zig(node);
         else if ((node->parent->parent->left != nullptr && node == node->parent->parent->left->left.get()) ||
@@ -130,8 +135,8 @@ void SplayTree<T>::splayUpTo(BSTNode<T>* node, BSTNode<T>* newParent) {
     }
 }
 
-template <typename T>
-void SplayTree<T>::zigZig(BSTNode<T>* node) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::zigZig(Node<T>* node) {
     if (node == node->parent->left.get()) {
         this->rotateRight(node->parent->parent);
         this->rotateRight(node->parent);
@@ -141,8 +146,8 @@ void SplayTree<T>::zigZig(BSTNode<T>* node) {
     }
 }
 
-template <typename T>
-void SplayTree<T>::zigZag(BSTNode<T>* node) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::zigZag(Node<T>* node) {
     if (node == node->parent->left.get()) {
         this->rotateRight(node->parent);
         this->rotateLeft(node->parent);
@@ -152,8 +157,8 @@ void SplayTree<T>::zigZag(BSTNode<T>* node) {
     }
 }
 
-template <typename T>
-void SplayTree<T>::zig(BSTNode<T>* node) {
+template <typename T, template <typename> class Node>
+void SplayTree<T, Node>::zig(Node<T>* node) {
     if (node == node->parent->left.get())
         this->rotateRight(node->parent);
     else
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 // These macros should be used inside the public part of a class definition 
 // to make these nodes usable as template  parameters of BSTBase
@@ -13,10 +16,13 @@
     NodeType<T>* parent; \
     \
     NodeType(const T& key) : key(key), left(nullptr), right(nullptr), parent(nullptr) {} \
+    NodeType(T&& key) : key(std::move(key)), left(nullptr), right(nullptr), parent(nullptr) {} \
     NodeType(const T& key, NodeType<T>* parent) : key(key), left(nullptr), right(nullptr), parent(parent) {} \
-    NodeType(const NodeType<T>& other) : key(other.key), left(nullptr), right(nullptr), parent(nullptr) {}
+    NodeType(const NodeType<T>& other) : key(other.key), left(nullptr), right(nullptr), parent(nullptr) {} \
+    NodeType(NodeType<T>&& other) : key(std::move(other.key)), left(nullptr), right(nullptr), parent(nullptr) {}
 
 // The varargs should be used to initialize other members of the node and a copy constructor must be provided (analogous to the one in BasicTreeNode())
+// A move constructor that moves the key should be provided as well, otherwise compact() copies every key
 #define TreeNode(NodeType, T, ...) \
     T key; \
     std::unique_ptr<NodeType<T>> left; \
@@ -24,4 +30,22 @@
     NodeType<T>* parent; \
     \
     NodeType(const T& key) : __VA_ARGS__, key(key), left(nullptr), right(nullptr), parent(nullptr) {} \
+    NodeType(T&& key) : __VA_ARGS__, key(std::move(key)), left(nullptr), right(nullptr), parent(nullptr) {} \
     NodeType(const T& key, NodeType<T>* parent) : __VA_ARGS__, key(key), left(nullptr), right(nullptr), parent(parent) {}
+
+// Nodes that have a "size_t count" member store every copy of a key in a single node (multiset mode).
+// The member should be initialized to 1 and copied by the copy constructor.
+template <template <typename> class Node, typename T, typename = void>
+struct IsCountedNode : std::false_type {};
+
+template <template <typename> class Node, typename T>
+struct IsCountedNode<Node, T, std::void_t<decltype(std::declval<Node<T>&>().count)>> : std::true_type {};
+
+
+template <template <typename> class Node, typename T>
+size_t nodeMultiplicity(const Node<T>* node) {
+    if constexpr (IsCountedNode<Node, T>::value)
+        return node->count;
+    else
+        return 1;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+// Define BST_ENABLE_STATS (or configure with -DBST_ENABLE_STATS=ON) to let the trees count what they do.
+// Without it BST_STATS() expands to nothing, so the counters cost nothing in release builds.
+#ifdef BST_ENABLE_STATS
+#define BST_STATS(statement) statement
+#else
+#define BST_STATS(statement)
+#endif
+
+struct TreeStats {
+    // Number of operations of each kind since the last reset
+    size_t inserts = 0;
+    size_t erases = 0;
+    size_t searches = 0;
+
+    // Work done by these operations
+    size_t comparisons = 0;
+    size_t rotations = 0;
+    size_t splaySteps = 0;
+    size_t recolorings = 0;
+
+    // Depth (number of visited nodes) of searches
+    size_t totalSearchDepth = 0;
+    size_t maxSearchDepth = 0;
+
+    size_t operations() const {
+        return inserts + erases + searches;
+    }
+
+    double averageSearchDepth() const {
+        return searches == 0 ? 0.0 : static_cast<double>(totalSearchDepth) / searches;
+    }
+
+    double comparisonsPerOperation() const {
+        return operations() == 0 ? 0.0 : static_cast<double>(comparisons) / operations();
+    }
+
+    double rotationsPerOperation() const {
+        return operations() == 0 ? 0.0 : static_cast<double>(rotations) / operations();
+    }
+
+    void recordSearch(size_t depth) {
+        ++searches;
+        totalSearchDepth += depth;
+        if (depth > maxSearchDepth)
+            maxSearchDepth = depth;
+    }
+
+    void reset() {
+        *this = TreeStats();
+    }
+};
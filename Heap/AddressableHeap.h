@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+// Identifies an element of an AddressableHeap for as long as it is in the heap.
+// Slots of removed elements are reused, but the generation makes handles of removed elements invalid.
+struct AddressableHeapHandle {
+    size_t slot;
+    size_t generation;
+
+    bool operator==(const AddressableHeapHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
+
+    bool operator!=(const AddressableHeapHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+// Heap whose elements can be changed and removed through the handle returned by insert().
+// Every element remembers its slot and every slot the position of its element, which place() keeps up to date.
+// decreaseKey() moves an element towards the extremum (for std::less towards the minimum), increaseKey() away from it
+template <typename T,
+          class Comp = std::less<T>,
+          size_t Arity = 2>
+class AddressableHeap {
+    static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+    struct Entry {
+        T key;
+        size_t slot;
+    };
+
+    struct Slot {
+        size_t position;  // Index in data_ or npos if the slot is free
+        size_t generation;
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    std::vector<Entry> data_;
+    std::vector<Slot> slots_;
+    std::vector<size_t> freeSlots_;
+    const Comp comparator_;
+
+   public:
+    using handle = AddressableHeapHandle;
+
+    explicit AddressableHeap(const Comp& comp = Comp()) : comparator_(comp) {}
+
+    handle insert(const T& key);  // O(log n)
+    handle insert(T&& key);
+
+    const T& extremum() const;
+    T extractExtremum();  // O(log n)
+
+    const T& key(handle h) const;
+    bool contains(handle h) const;
+
+    void decreaseKey(handle h, const T& key);  // O(log n)
+    void increaseKey(handle h, const T& key);  // O(log n)
+    void erase(handle h);  // O(log n)
+
+    void clear();
+
+    size_t size() const;
+    bool isEmpty() const;
+
+   private:
+    size_t position(handle h) const;
+    void eraseAt(size_t index);
+    size_t acquireSlot();
+    void releaseSlot(size_t slot);
+
+    void upHeapify(size_t index);
+    void downHeapify(size_t index);
+
+    static size_t firstChild(size_t index);
+    static size_t parent(size_t index);
+
+    void place(size_t index, Entry&& entry);
+};
+
+// Insert operation
+
+template <typename T, class Comp, size_t Arity>
+typename AddressableHeap<T, Comp, Arity>::handle AddressableHeap<T, Comp, Arity>::insert(const T& key) {
+    size_t slot = acquireSlot();
+    data_.push_back({key, slot});
+    slots_[slot].position = data_.size() - 1;
+    upHeapify(data_.size() - 1);
+
+    return {slot, slots_[slot].generation};
+}
+
+template <typename T, class Comp, size_t Arity>
+typename AddressableHeap<T, Comp, Arity>::handle AddressableHeap<T, Comp, Arity>::insert(T&& key) {
+    size_t slot = acquireSlot();
+    data_.push_back({std::move(key), slot});
+    slots_[slot].position = data_.size() - 1;
+    upHeapify(data_.size() - 1);
+
+    return {slot, slots_[slot].generation};
+}
+
+// Access functions
+
+template <typename T, class Comp, size_t Arity>
+const T& AddressableHeap<T, Comp, Arity>::extremum() const {
+    if (data_.empty())
+        throw std::runtime_error("Heap is empty");
+    return data_[0].key;
+}
+
+template <typename T, class Comp, size_t Arity>
+const T& AddressableHeap<T, Comp, Arity>::key(handle h) const {
+    return data_[position(h)].key;
+}
+
+template <typename T, class Comp, size_t Arity>
+bool AddressableHeap<T, Comp, Arity>::contains(handle h) const {
+    return h.slot < slots_.size() && slots_[h.slot].generation == h.generation && slots_[h.slot].position != npos;
+}
+
+// Update operations
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::decreaseKey(handle h, const T& key) {
+    size_t index = position(h);
+    if (comparator_(data_[index].key, key))
+        throw std::runtime_error("decreaseKey() would move the key away from the extremum");
+
+    data_[index].key = key;
+    upHeapify(index);
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::increaseKey(handle h, const T& key) {
+    size_t index = position(h);
+    if (comparator_(key, data_[index].key))
+        throw std::runtime_error("increaseKey() would move the key towards the extremum");
+
+    data_[index].key = key;
+    downHeapify(index);
+}
+
+// Delete operations
+
+template <typename T, class Comp, size_t Arity>
+T AddressableHeap<T, Comp, Arity>::extractExtremum() {
+    if (data_.empty())
+        throw std::runtime_error("Tried to extract from an empty heap");
+
+    T result = std::move(data_[0].key);
+    eraseAt(0);
+    return result;
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::erase(handle h) {
+    eraseAt(position(h));
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::clear() {
+    for (const Entry& entry : data_)
+        releaseSlot(entry.slot);
+    data_.clear();
+}
+
+template <typename T, class Comp, size_t Arity>
+size_t AddressableHeap<T, Comp, Arity>::size() const {
+    return data_.size();
+}
+
+template <typename T, class Comp, size_t Arity>
+bool AddressableHeap<T, Comp, Arity>::isEmpty() const {
+    return data_.empty();
+}
+
+// Utility functions
+
+template <typename T, class Comp, size_t Arity>
+size_t AddressableHeap<T, Comp, Arity>::position(handle h) const {
+    if (!contains(h))
+        throw std::runtime_error("Handle does not belong to an element of the heap");
+    return slots_[h.slot].position;
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::eraseAt(size_t index) {
+    releaseSlot(data_[index].slot);
+
+    size_t last = data_.size() - 1;
+    if (index != last)
+        place(index, std::move(data_[last]));
+    data_.pop_back();
+
+    if (index < data_.size()) {  // The moved element can belong above or below index
+        upHeapify(index);
+        downHeapify(index);
+    }
+}
+
+template <typename T, class Comp, size_t Arity>
+size_t AddressableHeap<T, Comp, Arity>::acquireSlot() {
+    if (freeSlots_.empty()) {
+        slots_.push_back({npos, 0});
+        return slots_.size() - 1;
+    }
+
+    size_t slot = freeSlots_.back();
+    freeSlots_.pop_back();
+    return slot;
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::releaseSlot(size_t slot) {
+    slots_[slot].position = npos;
+    ++slots_[slot].generation;
+    freeSlots_.push_back(slot);
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::upHeapify(size_t index) {
+    if (index == 0 || !comparator_(data_[index].key, data_[parent(index)].key))
+        return;
+
+    Entry entry = std::move(data_[index]);
+    do {
+        place(index, std::move(data_[parent(index)]));
+        index = parent(index);
+    } while (index > 0 && comparator_(entry.key, data_[parent(index)].key));
+    place(index, std::move(entry));
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::downHeapify(size_t index) {
+    size_t size = data_.size();
+    if (firstChild(index) >= size)
+        return;
+
+    Entry entry = std::move(data_[index]);
+    while (true) {
+        size_t first = firstChild(index);
+        if (first >= size)
+            break;
+        size_t last = std::min(first + Arity, size);
+
+        size_t extremumIndex = first;
+        for (size_t child = first + 1; child < last; ++child) {
+            if (comparator_(data_[child].key, data_[extremumIndex].key))
+                extremumIndex = child;
+        }
+
+        if (!comparator_(data_[extremumIndex].key, entry.key))
+            break;
+
+        place(index, std::move(data_[extremumIndex]));
+        index = extremumIndex;
+    }
+
+    place(index, std::move(entry));
+}
+
+template <typename T, class Comp, size_t Arity>
+size_t AddressableHeap<T, Comp, Arity>::firstChild(size_t index) {
+    return Arity * index + 1;
+}
+
+template <typename T, class Comp, size_t Arity>
+size_t AddressableHeap<T, Comp, Arity>::parent(size_t index) {
+    return (index - 1) / Arity;
+}
+
+template <typename T, class Comp, size_t Arity>
+void AddressableHeap<T, Comp, Arity>::place(size_t index, Entry&& entry) {  // Moves entry into the hole at index
+    data_[index] = std::move(entry);
+    slots_[data_[index].slot].position = index;
+}
\ No newline at end of file
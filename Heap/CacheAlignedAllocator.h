@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+// Allocator that places element Offset of every allocation at the start of a cache line (or a larger Alignment),
+// by leaving unused padding in front of the first element when Offset is not 0.
+// A d-ary heap's children of node i start at index d * i + 1, so with Offset = 1 every group of siblings starts at
+// the same position within a cache line. If d * sizeof(T) divides or is a multiple of Alignment, no group straddles
+// two cache lines.
+template <typename T, size_t Alignment = 64, size_t Offset = 0>
+class CacheAlignedAllocator {
+   public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = CacheAlignedAllocator<U, Alignment, Offset>;
+    };
+
+    static constexpr size_t alignment = std::max(Alignment, alignof(T));
+    // Bytes in front of the first element, so that element Offset is aligned (a multiple of alignof(T))
+    static constexpr size_t padding = (alignment - Offset * sizeof(T) % alignment) % alignment;
+
+    CacheAlignedAllocator() noexcept {}
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U, Alignment, Offset>&) noexcept {}
+
+    T* allocate(size_t n);
+    void deallocate(T* ptr, size_t n) noexcept;
+
+    template <typename U>
+    bool operator==(const CacheAlignedAllocator<U, Alignment, Offset>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const CacheAlignedAllocator<U, Alignment, Offset>&) const noexcept {
+        return false;
+    }
+};
+
+template <typename T, size_t Alignment, size_t Offset>
+T* CacheAlignedAllocator<T, Alignment, Offset>::allocate(size_t n) {
+    char* block = static_cast<char*>(::operator new(n * sizeof(T) + padding, std::align_val_t(alignment)));
+    return reinterpret_cast<T*>(block + padding);
+}
+
+template <typename T, size_t Alignment, size_t Offset>
+void CacheAlignedAllocator<T, Alignment, Offset>::deallocate(T* ptr, size_t) noexcept {
+    ::operator delete(reinterpret_cast<char*>(ptr) - padding, std::align_val_t(alignment));
+}
\ No newline at end of file
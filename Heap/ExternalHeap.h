@@ -0,0 +1,356 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Heap.h"
+
+struct ExternalHeapConfig {
+    size_t memoryBudget = size_t(64) << 20;  // Bytes of elements the insertion buffer holds before it is spilled as a run
+    std::filesystem::path tempDirectory = std::filesystem::temp_directory_path();
+    size_t ioBufferSize = size_t(1) << 20;  // Bytes read or written at once, every run keeps one buffer of this size
+    size_t mergeFanIn = 16;  // Number of runs of the same level that are merged into one run of the next level
+};
+
+// Priority queue for more elements than fit in memory. New elements go into an in memory Heap, which is written to a
+// temporary file as a sorted run whenever it reaches the memory budget. The runs are merged lazily: only the head of
+// every run is kept in a second Heap, and the next block of a run is read once its buffer is used up.
+// Spilled runs start at level 0, and once mergeFanIn runs share a level they are merged into one run of the next
+// level. So every element is rewritten once per level, log_mergeFanIn(spills) times, and at most mergeFanIn - 1 runs
+// per level are kept.
+template <typename T, class Comp = std::less<T>>
+class ExternalHeap {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value,
+                  "ExternalHeap writes its elements to files as raw bytes");
+
+    class Run;
+
+    struct RunHead {
+        T key;
+        Run* run;
+    };
+
+    struct RunHeadComp {
+        Comp comparator;
+
+        bool operator()(const RunHead& lhs, const RunHead& rhs) const {
+            return comparator(lhs.key, rhs.key);
+        }
+    };
+
+    ExternalHeapConfig config_;
+    size_t bufferCapacity_;
+    size_t ioBufferCapacity_;
+    Heap<T, Comp> buffer_;
+    std::vector<std::unique_ptr<Run>> runs_;
+    Heap<RunHead, RunHeadComp> runHeads_;
+    size_t size_;
+    const Comp comparator_;
+
+   public:
+    explicit ExternalHeap(const ExternalHeapConfig& config = ExternalHeapConfig(), const Comp& comp = Comp());
+
+    ExternalHeap(const ExternalHeap<T, Comp>&) = delete;
+    ExternalHeap<T, Comp>& operator=(const ExternalHeap<T, Comp>&) = delete;
+
+    void insert(const T& key);  // O(log n), plus the sequential write of a run when the buffer is full
+
+    const T& extremum() const;
+    T extractExtremum();  // O(log n + log r), where r is the number of runs
+
+    void clear();  // Also removes the run files
+
+    size_t size() const;
+    bool isEmpty() const;
+    size_t runCount() const;
+
+   private:
+    bool extremumInRuns() const;
+
+    void spill();
+    void mergeLevel(size_t level);
+    size_t runsOnLevel(size_t level) const;
+    void addRun(std::unique_ptr<Run> run);
+    void removeRun(Run* run);
+    T extractFromRuns();
+
+    static Run* advanceHead(Heap<RunHead, RunHeadComp>& heads);
+};
+
+// Sorted sequence of elements in a temporary file, which is written once and then read from the front.
+// The file is removed when the run is destroyed
+template <typename T, class Comp>
+class ExternalHeap<T, Comp>::Run {
+    std::filesystem::path path_;
+    std::FILE* file_;
+    size_t level_;  // Number of merges the elements went through
+    std::vector<T> buffer_;
+    size_t bufferCapacity_;
+    size_t position_;  // Next element of buffer_ to read
+    size_t unread_;  // Elements in the file that were not loaded into buffer_ yet
+
+   public:
+    Run(const std::filesystem::path& directory, size_t bufferCapacity, size_t level);
+    ~Run();
+
+    Run(const Run&) = delete;
+    Run& operator=(const Run&) = delete;
+
+    void write(const T& key);
+    void finishWriting();  // Flushes the buffer and rewinds the file for reading
+
+    bool read(T& key);  // Returns false once the run is used up
+
+    size_t level() const;
+
+   private:
+    void flush();
+    void fill();
+};
+
+// Constructors
+
+template <typename T, class Comp>
+ExternalHeap<T, Comp>::ExternalHeap(const ExternalHeapConfig& config, const Comp& comp)
+    : config_(config),
+      bufferCapacity_(std::max<size_t>(config.memoryBudget / sizeof(T), 1)),
+      ioBufferCapacity_(std::max<size_t>(config.ioBufferSize / sizeof(T), 1)),
+      buffer_(comp),
+      runHeads_(RunHeadComp{comp}),
+      size_(0),
+      comparator_(comp) {
+    if (config.mergeFanIn < 2)
+        throw std::runtime_error("ExternalHeap needs to merge at least two runs at once");
+}
+
+// Insert operations
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::insert(const T& key) {
+    if (buffer_.size() == bufferCapacity_)
+        spill();
+
+    buffer_.insert(key);
+    ++size_;
+}
+
+// Access and delete operations
+
+template <typename T, class Comp>
+const T& ExternalHeap<T, Comp>::extremum() const {
+    if (size_ == 0)
+        throw std::runtime_error("Heap is empty");
+    return extremumInRuns() ? runHeads_.extremum().key : buffer_.extremum();
+}
+
+template <typename T, class Comp>
+T ExternalHeap<T, Comp>::extractExtremum() {
+    if (size_ == 0)
+        throw std::runtime_error("Heap is empty");
+
+    --size_;
+    return extremumInRuns() ? extractFromRuns() : buffer_.extractExtremum();
+}
+
+// Utility functions
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::clear() {
+    buffer_.clear();
+    runHeads_.clear();
+    runs_.clear();
+    size_ = 0;
+}
+
+template <typename T, class Comp>
+size_t ExternalHeap<T, Comp>::size() const {
+    return size_;
+}
+
+template <typename T, class Comp>
+bool ExternalHeap<T, Comp>::isEmpty() const {
+    return size_ == 0;
+}
+
+template <typename T, class Comp>
+size_t ExternalHeap<T, Comp>::runCount() const {
+    return runs_.size();
+}
+
+// private utility
+
+template <typename T, class Comp>
+bool ExternalHeap<T, Comp>::extremumInRuns() const {
+    if (runHeads_.isEmpty())
+        return false;
+    if (buffer_.isEmpty())
+        return true;
+    return !comparator_(buffer_.extremum(), runHeads_.extremum().key);
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::spill() {
+    auto run = std::make_unique<Run>(config_.tempDirectory, ioBufferCapacity_, 0);
+    for (const T& key : buffer_.intoSortedVector())
+        run->write(key);
+    addRun(std::move(run));
+
+    for (size_t level = 0; runsOnLevel(level) >= config_.mergeFanIn; ++level)
+        mergeLevel(level);
+}
+
+// Merges the runs of one level into a single run of the next level. Their heads are taken out of runHeads_, so the
+// merge only reads these runs
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::mergeLevel(size_t level) {
+    std::vector<RunHead> mergedHeads;
+    std::vector<RunHead> otherHeads;
+    while (!runHeads_.isEmpty()) {
+        RunHead head = runHeads_.extractExtremum();
+        (head.run->level() == level ? mergedHeads : otherHeads).push_back(head);
+    }
+    runHeads_.assign(std::move(otherHeads));
+
+    Heap<RunHead, RunHeadComp> heads(std::move(mergedHeads), RunHeadComp{comparator_});
+    auto merged = std::make_unique<Run>(config_.tempDirectory, ioBufferCapacity_, level + 1);
+    while (!heads.isEmpty()) {
+        merged->write(heads.extremum().key);
+        if (Run* usedUp = advanceHead(heads))
+            removeRun(usedUp);
+    }
+    addRun(std::move(merged));
+}
+
+template <typename T, class Comp>
+size_t ExternalHeap<T, Comp>::runsOnLevel(size_t level) const {
+    return std::count_if(runs_.begin(), runs_.end(), [level](const std::unique_ptr<Run>& run) { return run->level() == level; });
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::addRun(std::unique_ptr<Run> run) {
+    run->finishWriting();
+
+    RunHead head{T(), run.get()};
+    if (!run->read(head.key))
+        return;
+
+    runs_.push_back(std::move(run));
+    runHeads_.insert(head);
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::removeRun(Run* run) {
+    for (size_t i = 0; i < runs_.size(); ++i) {
+        if (runs_[i].get() == run) {
+            runs_[i] = std::move(runs_.back());
+            runs_.pop_back();
+            return;
+        }
+    }
+}
+
+template <typename T, class Comp>
+T ExternalHeap<T, Comp>::extractFromRuns() {
+    T result = runHeads_.extremum().key;
+    if (Run* usedUp = advanceHead(runHeads_))
+        removeRun(usedUp);
+    return result;
+}
+
+// Replaces the extremum of heads with the next element of its run, or removes it if the run is used up.
+// Returns the used up run
+template <typename T, class Comp>
+typename ExternalHeap<T, Comp>::Run* ExternalHeap<T, Comp>::advanceHead(Heap<RunHead, RunHeadComp>& heads) {
+    RunHead head = heads.extremum();
+    if (head.run->read(head.key)) {
+        heads.replaceExtremum(head);
+        return nullptr;
+    }
+
+    heads.extractExtremum();
+    return head.run;
+}
+
+// Run
+
+template <typename T, class Comp>
+ExternalHeap<T, Comp>::Run::Run(const std::filesystem::path& directory, size_t bufferCapacity, size_t level)
+    : file_(nullptr), level_(level), bufferCapacity_(bufferCapacity), position_(0), unread_(0) {
+    static std::atomic<size_t> runCounter(0);
+    static const std::string prefix = "ExternalHeap-" + std::to_string(std::random_device()()) + "-";
+
+    path_ = directory / (prefix + std::to_string(runCounter++) + ".run");
+    file_ = std::fopen(path_.string().c_str(), "w+bx");
+    if (file_ == nullptr)
+        throw std::runtime_error("Could not create run file " + path_.string());
+
+    std::setvbuf(file_, nullptr, _IONBF, 0);  // Reads and writes are already done in blocks of bufferCapacity elements
+    buffer_.reserve(bufferCapacity_);
+}
+
+template <typename T, class Comp>
+ExternalHeap<T, Comp>::Run::~Run() {
+    std::fclose(file_);
+    std::remove(path_.string().c_str());
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::Run::write(const T& key) {
+    buffer_.push_back(key);
+    if (buffer_.size() == bufferCapacity_)
+        flush();
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::Run::finishWriting() {
+    flush();
+    if (std::fseek(file_, 0, SEEK_SET) != 0)
+        throw std::runtime_error("Could not rewind run file " + path_.string());
+}
+
+template <typename T, class Comp>
+bool ExternalHeap<T, Comp>::Run::read(T& key) {
+    if (position_ == buffer_.size()) {
+        if (unread_ == 0)
+            return false;
+        fill();
+    }
+
+    key = buffer_[position_++];
+    return true;
+}
+
+template <typename T, class Comp>
+size_t ExternalHeap<T, Comp>::Run::level() const {
+    return level_;
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::Run::flush() {
+    if (std::fwrite(buffer_.data(), sizeof(T), buffer_.size(), file_) != buffer_.size())
+        throw std::runtime_error("Could not write run file " + path_.string());
+
+    unread_ += buffer_.size();
+    buffer_.clear();
+}
+
+template <typename T, class Comp>
+void ExternalHeap<T, Comp>::Run::fill() {
+    size_t count = std::min(unread_, bufferCapacity_);
+    buffer_.resize(count);
+    if (std::fread(buffer_.data(), sizeof(T), count, file_) != count)
+        throw std::runtime_error("Could not read run file " + path_.string());
+
+    unread_ -= count;
+    position_ = 0;
+}
\ No newline at end of file
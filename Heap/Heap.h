@@ -1,141 +1,432 @@
 #pragma once
 
-#include <cmath>
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "CacheAlignedAllocator.h"
+#include "SimdChildSelector.h"
+
+#include "../Utility/RunParallel.h"
+
+// Every node has up to Arity children. Larger arities make the heap flatter, so insertions compare less,
+// while extractions compare more per level but visit fewer levels and the children are next to each other in memory
 template <typename T, 
           class Comp = std::less<T>,
-          class Container = std::vector<T>>
+          class Container = std::vector<T>,
+          size_t Arity = 2>
 class Heap {
+    static_assert(Arity >= 2, "A heap needs at least two children per node");
+
     Container data_;
     const Comp comparator_;
 
    public:
     explicit Heap(const Comp& comp = Comp()) : comparator_(comp) {}
     Heap(std::initializer_list<T> init, const Comp& comp = Comp());
+    explicit Heap(Container&& data, const Comp& comp = Comp());  // O(n), takes over the elements without copying them
+    template <class InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Heap(InputIt first, InputIt last, const Comp& comp = Comp());  // O(n)
+
+    Heap(Heap<T, Comp, Container, Arity>& heap) : data_(heap.data_), comparator_(heap.comparator_) {}
+    Heap(Heap<T, Comp, Container, Arity>&& heap) noexcept : data_(std::move(heap.data_)), comparator_(std::move(heap.comparator_)) {}
 
-    Heap(Heap<T, Comp, Container>& heap) : data_(heap.data_), comparator_(heap.comparator_) {}
-    Heap(Heap<T, Comp, Container>&& heap) noexcept : data_(std::move(heap.data_)), comparator_(std::move(heap.comparator_)) {}
+    Heap<T, Comp, Container, Arity>& operator=(std::initializer_list<T> init);
+    // Replaces the elements with data. threadCount = 0 uses one thread per core, small heaps are always built on the
+    // calling thread, and all other ways of building a heap use only the calling thread
+    void assign(Container&& data, size_t threadCount = 1);  // O(n)
 
-    Heap<T, Comp, Container>& operator=(std::initializer_list<T> init);
+    void insert(const T& key);  // O(log n)
+    void insert(T&& key);
+    template <typename... Args>
+    void emplace(Args&&... args);
 
-    void insert(const T& key);
+    const T& extremum() const;
+    T extractExtremum();  // O(log n)
 
-    T extractExtremum();
+    // Combined operations that only sift once
+    T insertAndExtract(T key);  // Inserts key and then extracts the extremum
+    T replaceExtremum(T key);  // Extracts the extremum and then inserts key
+
+    void merge(Heap<T, Comp, Container, Arity>&& other);  // O(n + m)
+
+    // Batch extraction. A container sorted in extraction order is a valid heap, so the sorts work on the storage itself.
+    // threadCount = 0 uses one thread per core, small heaps are always sorted on the calling thread
+    template <class OutputIt>
+    OutputIt extractN(size_t k, OutputIt out);  // Moves the min(k, n) first elements to out in extraction order
+    void sortInPlace(size_t threadCount = 1);  // O(n log n)
+    Container intoSortedVector(size_t threadCount = 1);  // O(n log n), leaves the heap empty
 
     void clear();
 
-    size_t size();
+    size_t size() const;
+    bool isEmpty() const;
 
    private:
+    // assign() builds heaps with at least this many elements by heapifying subtrees in parallel
+    static constexpr size_t parallelBuildThreshold = size_t(1) << 16;
+    static constexpr size_t subtreesPerThread = 8;
+    static constexpr size_t parallelSortThreshold = size_t(1) << 16;
+
+    void upHeapify(size_t index);
     void downHeapify(size_t startIndex);
+    size_t extremalChild(size_t first, size_t last) const;
 
-    void buildHeap();
+    void buildHeap(size_t threadCount = 1);
+    void heapifySubtree(size_t root);
 
-    size_t left(size_t index);
-    size_t right(size_t index);
-    size_t parent(size_t index);
+    void parallelSort(size_t threadCount);
 
-    void swap(size_t i1, size_t i2);
+    static size_t firstChild(size_t index);
+    static size_t parent(size_t index);
+    static size_t height(size_t size);
 };
 
+// Heap with Arity children per node, whose groups of siblings (which start at index 1) are aligned to cache lines
+template <typename T, size_t Arity, class Comp = std::less<T>>
+using DaryHeap = Heap<T, Comp, std::vector<T, CacheAlignedAllocator<T, 64, 1>>, Arity>;
+
 // Constructors
 
-template <typename T, class Comp, class Container>
-Heap<T, Comp, Container>::Heap(std::initializer_list<T> init, const Comp& comp) : Heap(comp) {
+template <typename T, class Comp, class Container, size_t Arity>
+Heap<T, Comp, Container, Arity>::Heap(std::initializer_list<T> init, const Comp& comp) : Heap(comp) {
     data_ = init;
     buildHeap();
 }
 
+template <typename T, class Comp, class Container, size_t Arity>
+Heap<T, Comp, Container, Arity>::Heap(Container&& data, const Comp& comp) : data_(std::move(data)), comparator_(comp) {
+    buildHeap();
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+template <class InputIt, typename>
+Heap<T, Comp, Container, Arity>::Heap(InputIt first, InputIt last, const Comp& comp) : data_(first, last), comparator_(comp) {
+    buildHeap();
+}
+
 // Equality operators
 
-template <typename T, class Comp, class Container>
-Heap<T, Comp, Container>& Heap<T, Comp, Container>::operator=(std::initializer_list<T> init) {
+template <typename T, class Comp, class Container, size_t Arity>
+Heap<T, Comp, Container, Arity>& Heap<T, Comp, Container, Arity>::operator=(std::initializer_list<T> init) {
     data_ = init;
     buildHeap();
     return *this;
 }
 
-// Insert operation
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::assign(Container&& data, size_t threadCount) {
+    data_ = std::move(data);
+    buildHeap(threadCount);
+}
+
+// Insert operations
 
-template <typename T, class Comp, class Container>
-void Heap<T, Comp, Container>::insert(const T& key) {
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::insert(const T& key) {
     data_.push_back(key);
+    upHeapify(data_.size() - 1);
+}
 
-    size_t i = data_.size() - 1;
-    while (i > 0 && comparator_(data_[i], data_[parent(i)])) {
-        swap(i, parent(i));
-        i = parent(i);
-    }
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::insert(T&& key) {
+    data_.push_back(std::move(key));
+    upHeapify(data_.size() - 1);
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+template <typename... Args>
+void Heap<T, Comp, Container, Arity>::emplace(Args&&... args) {
+    data_.emplace_back(std::forward<Args>(args)...);
+    upHeapify(data_.size() - 1);
+}
+
+// Access and delete operations
+
+template <typename T, class Comp, class Container, size_t Arity>
+const T& Heap<T, Comp, Container, Arity>::extremum() const {
+    if (data_.empty())
+        throw std::runtime_error("Heap is empty");
+    return data_[0];
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+T Heap<T, Comp, Container, Arity>::extractExtremum() {
+    if (data_.empty())
+        throw std::runtime_error("Tried to extract from an empty heap");
+
+    T result = std::move(data_[0]);
+    if (data_.size() > 1)
+        data_[0] = std::move(data_.back());
+    data_.pop_back();
+    downHeapify(0);
+    return result;
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+T Heap<T, Comp, Container, Arity>::insertAndExtract(T key) {
+    if (data_.empty() || !comparator_(data_[0], key))  // key would be the extremum itself
+        return key;
+
+    T result = std::move(data_[0]);
+    data_[0] = std::move(key);
+    downHeapify(0);
+    return result;
 }
 
-// Delete operations
+template <typename T, class Comp, class Container, size_t Arity>
+T Heap<T, Comp, Container, Arity>::replaceExtremum(T key) {
+    if (data_.empty())
+        throw std::runtime_error("Tried to extract from an empty heap");
 
-template <typename T, class Comp, class Container>
-T Heap<T, Comp, Container>::extractExtremum() {
-    T max = data_[0];
-    data_[0] = data_[data_.size() - 1];
-    data_.erase(--data_.end());
+    T result = std::move(data_[0]);
+    data_[0] = std::move(key);
     downHeapify(0);
-    return max;
+    return result;
+}
+
+// Moves all elements of other into this heap. Few elements are inserted one by one,
+// otherwise they are appended and the heap is rebuilt
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::merge(Heap<T, Comp, Container, Arity>&& other) {
+    size_t oldSize = data_.size();
+    size_t newSize = oldSize + other.data_.size();
+
+    for (T& key : other.data_)
+        data_.push_back(std::move(key));
+    other.data_.clear();
+
+    if ((newSize - oldSize) * height(newSize) < newSize) {
+        for (size_t i = oldSize; i < newSize; ++i)
+            upHeapify(i);
+    } else {
+        buildHeap();
+    }
+}
+
+// Few elements are extracted one by one. When k sift downs would cost more than O(n), the k first elements are
+// partitioned to the front instead, sorted and moved out, and the rest is rebuilt into a heap
+template <typename T, class Comp, class Container, size_t Arity>
+template <class OutputIt>
+OutputIt Heap<T, Comp, Container, Arity>::extractN(size_t k, OutputIt out) {
+    size_t size = data_.size();
+    if (k >= size) {
+        sortInPlace();
+        for (T& key : data_)
+            *out++ = std::move(key);
+        data_.clear();
+        return out;
+    }
+
+    if (k * height(size) < size) {
+        for (size_t i = 0; i < k; ++i) {
+            *out++ = std::move(data_[0]);
+            data_[0] = std::move(data_.back());
+            data_.pop_back();
+            downHeapify(0);
+        }
+        return out;
+    }
+
+    auto split = data_.begin() + k;
+    std::nth_element(data_.begin(), split, data_.end(), comparator_);
+    std::sort(data_.begin(), split, comparator_);
+    for (auto it = data_.begin(); it != split; ++it)
+        *out++ = std::move(*it);
+
+    data_.erase(data_.begin(), split);
+    buildHeap();
+    return out;
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::sortInPlace(size_t threadCount) {
+    threadCount = resolveThreadCount(threadCount);
+    if (threadCount > 1 && data_.size() >= parallelSortThreshold)
+        parallelSort(threadCount);
+    else
+        std::sort(data_.begin(), data_.end(), comparator_);
 }
 
-template <typename T, class Comp, class Container>
-void Heap<T, Comp, Container>::clear() {
+template <typename T, class Comp, class Container, size_t Arity>
+Container Heap<T, Comp, Container, Arity>::intoSortedVector(size_t threadCount) {
+    sortInPlace(threadCount);
+    Container result = std::move(data_);
+    data_.clear();  // A moved from container is only guaranteed to be valid
+    return result;
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::clear() {
     data_.clear();
 }
 
-template <typename T, class Comp, class Container>
-size_t Heap<T, Comp, Container>::size() {
+template <typename T, class Comp, class Container, size_t Arity>
+size_t Heap<T, Comp, Container, Arity>::size() const {
     return data_.size();
 }
 
+template <typename T, class Comp, class Container, size_t Arity>
+bool Heap<T, Comp, Container, Arity>::isEmpty() const {
+    return data_.empty();
+}
+
 // Utility functions
 
-template <typename T, class Comp, class Container>
-void Heap<T, Comp, Container>::downHeapify(size_t startIndex) {
-    size_t maxIndex = startIndex;
-    size_t prevIndex = -1;
-    while (maxIndex != prevIndex) {
-        prevIndex = maxIndex;
+// The sift functions move the element out and shift the elements on its path into the hole,
+// which needs one move per level instead of the three of a swap
 
-        if (left(prevIndex) < data_.size() && !comparator_(data_[maxIndex], data_[left(prevIndex)]))
-            maxIndex = left(prevIndex);
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::upHeapify(size_t index) {
+    if (index == 0 || !comparator_(data_[index], data_[parent(index)]))
+        return;
 
-        if (right(prevIndex) < data_.size() && !comparator_(data_[maxIndex], data_[right(prevIndex)]))
-            maxIndex = right(prevIndex);
+    T key = std::move(data_[index]);
+    do {
+        data_[index] = std::move(data_[parent(index)]);
+        index = parent(index);
+    } while (index > 0 && comparator_(key, data_[parent(index)]));
+    data_[index] = std::move(key);
+}
+
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::downHeapify(size_t startIndex) {
+    size_t index = startIndex;
+    size_t size = data_.size();
+    if (firstChild(index) >= size)
+        return;
+
+    T key = std::move(data_[index]);
+    while (true) {
+        size_t first = firstChild(index);
+        if (first >= size)
+            break;
+        size_t last = std::min(first + Arity, size);
+
+        size_t extremumIndex = extremalChild(first, last);
+        if (!comparator_(data_[extremumIndex], key))
+            break;
+
+        data_[index] = std::move(data_[extremumIndex]);
+        index = extremumIndex;
+    }
+    data_[index] = std::move(key);
+}
+
+// Wide heaps of 32 bit keys in contiguous memory compare all children of a node at once if the CPU supports it
+template <typename T, class Comp, class Container, size_t Arity>
+size_t Heap<T, Comp, Container, Arity>::extremalChild(size_t first, size_t last) const {
+    if constexpr (SimdChildSelector<T, Comp>::enabled && IsContiguousContainer<Container>::value && (Arity == 8 || Arity == 16)) {
+        if (last - first == Arity) {
+            size_t offset = SimdChildSelector<T, Comp>::select(&data_[first], Arity);
+            if (offset != SimdChildSelector<T, Comp>::npos)
+                return first + offset;
+        }
+    }
+
+    size_t extremumIndex = first;
+    for (size_t child = first + 1; child < last; ++child) {
+        if (comparator_(data_[child], data_[extremumIndex]))
+            extremumIndex = child;
+    }
+    return extremumIndex;
+}
+
+// Large heaps are split at the first level with enough nodes to give every thread several subtrees.
+// These subtrees are independent, so they are heapified in parallel before the levels above them.
+// Every thread gets at least parallelBuildThreshold / subtreesPerThread elements, so the level always lies inside the heap.
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::buildHeap(size_t threadCount) {  // O(n)
+    size_t size = data_.size();
+    if (size < 2)
+        return;
+
+    threadCount = std::min(resolveThreadCount(threadCount), size / (parallelBuildThreshold / subtreesPerThread));
+    if (threadCount <= 1 || size < parallelBuildThreshold) {
+        for (size_t i = parent(size - 1) + 1; i > 0; --i)
+            downHeapify(i - 1);
+        return;
+    }
 
-        if (maxIndex != prevIndex)
-            swap(prevIndex, maxIndex);
+    size_t levelStart = 0;
+    size_t levelSize = 1;
+    while (levelSize < threadCount * subtreesPerThread && firstChild(levelStart) < size) {
+        levelStart = firstChild(levelStart);
+        levelSize *= Arity;
     }
+    size_t levelEnd = std::min(levelStart + levelSize, size);
+
+    auto task = [&](size_t index) {
+        heapifySubtree(levelStart + index);
+    };
+    runParallel(levelEnd - levelStart, threadCount, task);
+
+    for (size_t i = levelStart; i > 0; --i)
+        downHeapify(i - 1);
 }
 
-template <typename T, class Comp, class Container>
-void Heap<T, Comp, Container>::buildHeap() {
-    int size = data_.size();
-    for (int i = ceil((size - 1) / 2.0) - 1; i > -1; --i)
-        downHeapify(i);
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::heapifySubtree(size_t root) {
+    // The descendants of root at each depth are next to each other in data_
+    std::vector<std::pair<size_t, size_t>> levels;
+    size_t first = root;
+    size_t count = 1;
+    while (first < data_.size()) {
+        levels.emplace_back(first, std::min(first + count, data_.size()));
+        first = firstChild(first);
+        count *= Arity;
+    }
+
+    for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+        for (size_t i = level->second; i > level->first; --i)
+            downHeapify(i - 1);
+    }
 }
 
-template <typename T, class Comp, class Container>
-size_t Heap<T, Comp, Container>::left(size_t index) {
-    return 2 * (index + 1) - 1;
+// Partitions the elements into one range per thread with nth_element, so every range only holds elements
+// that belong between its neighbours, and sorts the ranges in parallel
+template <typename T, class Comp, class Container, size_t Arity>
+void Heap<T, Comp, Container, Arity>::parallelSort(size_t threadCount) {
+    using Iterator = typename Container::iterator;
+    std::vector<std::pair<Iterator, Iterator>> ranges;
+
+    auto partition = [&](auto& self, Iterator first, Iterator last, size_t parts) -> void {
+        if (parts == 1) {
+            ranges.emplace_back(first, last);
+            return;
+        }
+
+        size_t leftParts = parts / 2;
+        Iterator middle = first + (last - first) * leftParts / parts;
+        std::nth_element(first, middle, last, comparator_);
+        self(self, first, middle, leftParts);
+        self(self, middle, last, parts - leftParts);
+    };
+    partition(partition, data_.begin(), data_.end(), threadCount);
+
+    auto task = [&](size_t index) {
+        std::sort(ranges[index].first, ranges[index].second, comparator_);
+    };
+    runParallel(ranges.size(), threadCount, task);
 }
 
-template <typename T, class Comp, class Container>
-size_t Heap<T, Comp, Container>::right(size_t index) {
-    return 2 * (index + 1);
+template <typename T, class Comp, class Container, size_t Arity>
+size_t Heap<T, Comp, Container, Arity>::firstChild(size_t index) {
+    return Arity * index + 1;
 }
 
-template <typename T, class Comp, class Container>
-size_t Heap<T, Comp, Container>::parent(size_t index) {
-    return ceil(index / 2.0) - 1;
+template <typename T, class Comp, class Container, size_t Arity>
+size_t Heap<T, Comp, Container, Arity>::parent(size_t index) {
+    return (index - 1) / Arity;
 }
 
-template <typename T, class Comp, class Container>
-void Heap<T, Comp, Container>::swap(size_t i1, size_t i2) {
-    T tmp = std::move(data_[i1]);
-    data_[i1] = std::move(data_[i2]);
-    data_[i2] = std::move(tmp);
+template <typename T, class Comp, class Container, size_t Arity>
+size_t Heap<T, Comp, Container, Arity>::height(size_t size) {  // Number of levels below the root
+    size_t levels = 0;
+    for (size_t levelNodes = 1, nodes = 1; nodes < size; levelNodes *= Arity, nodes += levelNodes)
+        ++levels;
+    return levels;
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Heap.h"
+
+// Merges sorted sources, given as pairs of input iterators, into one sorted stream.
+// Every source has a cursor in a Heap that holds its current element, so comparisons do not go through the iterators,
+// and advancing a source replaces the extremum of the heap with one sift down.
+// Elements are taken from the sources with *it, so sources wrapped in std::make_move_iterator are moved from.
+// Equal elements keep the order of their sources.
+template <class InputIt, class Comp = std::less<typename std::iterator_traits<InputIt>::value_type>>
+class KWayMerger {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+
+    struct Cursor {
+        T key;
+        InputIt next;
+        InputIt last;
+        size_t source;
+    };
+
+    struct CursorComp {
+        Comp comparator;
+
+        bool operator()(const Cursor& lhs, const Cursor& rhs) const {
+            if (comparator(lhs.key, rhs.key))
+                return true;
+            return !comparator(rhs.key, lhs.key) && lhs.source < rhs.source;
+        }
+    };
+
+    Heap<Cursor, CursorComp> cursors_;
+    size_t sourceCount_;
+
+   public:
+    explicit KWayMerger(const Comp& comp = Comp()) : cursors_(CursorComp{comp}), sourceCount_(0) {}
+    explicit KWayMerger(const std::vector<std::pair<InputIt, InputIt>>& sources, const Comp& comp = Comp());
+
+    void addSource(InputIt first, InputIt last);  // O(log k), where k is the number of sources
+
+    const T& peek() const;
+    T next();  // O(log k)
+
+    template <class OutputIt>
+    OutputIt mergeInto(OutputIt out);  // Moves the rest of the merged stream to out
+
+    size_t activeSources() const;  // Sources that still have elements
+    bool isEmpty() const;
+};
+
+// Constructors
+
+template <class InputIt, class Comp>
+KWayMerger<InputIt, Comp>::KWayMerger(const std::vector<std::pair<InputIt, InputIt>>& sources, const Comp& comp) : KWayMerger(comp) {
+    for (const auto& source : sources)
+        addSource(source.first, source.second);
+}
+
+// Insert operations
+
+template <class InputIt, class Comp>
+void KWayMerger<InputIt, Comp>::addSource(InputIt first, InputIt last) {
+    size_t source = sourceCount_++;
+    if (first == last)
+        return;
+
+    T key = *first;
+    ++first;
+    cursors_.insert(Cursor{std::move(key), std::move(first), std::move(last), source});
+}
+
+// Access and delete operations
+
+template <class InputIt, class Comp>
+const typename KWayMerger<InputIt, Comp>::T& KWayMerger<InputIt, Comp>::peek() const {
+    if (cursors_.isEmpty())
+        throw std::runtime_error("All sources are used up");
+    return cursors_.extremum().key;
+}
+
+// The cursor of the extremum is advanced in place of the extremum, only used up sources leave the heap
+template <class InputIt, class Comp>
+typename KWayMerger<InputIt, Comp>::T KWayMerger<InputIt, Comp>::next() {
+    if (cursors_.isEmpty())
+        throw std::runtime_error("All sources are used up");
+
+    const Cursor& top = cursors_.extremum();
+    if (top.next == top.last)
+        return cursors_.extractExtremum().key;
+
+    InputIt next = top.next;
+    T key = *next;
+    ++next;
+    return cursors_.replaceExtremum(Cursor{std::move(key), std::move(next), top.last, top.source}).key;
+}
+
+template <class InputIt, class Comp>
+template <class OutputIt>
+OutputIt KWayMerger<InputIt, Comp>::mergeInto(OutputIt out) {
+    while (!cursors_.isEmpty())
+        *out++ = next();
+    return out;
+}
+
+// Utility functions
+
+template <class InputIt, class Comp>
+size_t KWayMerger<InputIt, Comp>::activeSources() const {
+    return cursors_.size();
+}
+
+template <class InputIt, class Comp>
+bool KWayMerger<InputIt, Comp>::isEmpty() const {
+    return cursors_.isEmpty();
+}
\ No newline at end of file
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Double ended priority queue in a single array. Nodes on even levels (starting with the root) are smaller than
+// all their descendants and nodes on odd levels are larger, so the minimum is the root and the maximum one of its children.
+// "Smaller" is defined by Comp, so with std::greater findMin() returns the largest element.
+template <typename T,
+          class Comp = std::less<T>,
+          class Container = std::vector<T>>
+class MinMaxHeap {
+    Container data_;
+    const Comp comparator_;
+
+   public:
+    explicit MinMaxHeap(const Comp& comp = Comp()) : comparator_(comp) {}
+    MinMaxHeap(std::initializer_list<T> init, const Comp& comp = Comp());
+    explicit MinMaxHeap(Container&& data, const Comp& comp = Comp());  // O(n)
+
+    void insert(const T& key);  // O(log n)
+    void insert(T&& key);  // O(log n)
+
+    const T& findMin() const;  // O(1)
+    const T& findMax() const;  // O(1)
+
+    T extractMin();  // O(log n)
+    T extractMax();  // O(log n)
+
+    void clear();
+
+    size_t size() const;
+    bool isEmpty() const;
+
+   private:
+    void buildHeap();
+
+    void bubbleUp(size_t index);
+    template <bool IsMinLevel>
+    void bubbleUpLevels(size_t index);
+
+    void trickleDown(size_t index);
+    template <bool IsMinLevel>
+    void trickleDownLevels(size_t index);
+
+    template <bool IsMinLevel>
+    bool isBetter(const T& first, const T& second) const;  // On min levels smaller, on max levels larger
+
+    size_t maxIndex() const;
+    T extractAt(size_t index);
+
+    static bool isMinLevel(size_t index);
+    static size_t parent(size_t index);
+    static size_t firstChild(size_t index);
+
+    void swap(size_t i1, size_t i2);
+};
+
+// Constructors
+
+template <typename T, class Comp, class Container>
+MinMaxHeap<T, Comp, Container>::MinMaxHeap(std::initializer_list<T> init, const Comp& comp) : data_(init), comparator_(comp) {
+    buildHeap();
+}
+
+template <typename T, class Comp, class Container>
+MinMaxHeap<T, Comp, Container>::MinMaxHeap(Container&& data, const Comp& comp) : data_(std::move(data)), comparator_(comp) {
+    buildHeap();
+}
+
+// Insert operations
+
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::insert(const T& key) {
+    data_.push_back(key);
+    bubbleUp(data_.size() - 1);
+}
+
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::insert(T&& key) {
+    data_.push_back(std::move(key));
+    bubbleUp(data_.size() - 1);
+}
+
+// Access and delete operations
+
+template <typename T, class Comp, class Container>
+const T& MinMaxHeap<T, Comp, Container>::findMin() const {
+    if (data_.empty())
+        throw std::runtime_error("Heap is empty");
+    return data_[0];
+}
+
+template <typename T, class Comp, class Container>
+const T& MinMaxHeap<T, Comp, Container>::findMax() const {
+    if (data_.empty())
+        throw std::runtime_error("Heap is empty");
+    return data_[maxIndex()];
+}
+
+template <typename T, class Comp, class Container>
+T MinMaxHeap<T, Comp, Container>::extractMin() {
+    if (data_.empty())
+        throw std::runtime_error("Tried to extract from an empty heap");
+    return extractAt(0);
+}
+
+template <typename T, class Comp, class Container>
+T MinMaxHeap<T, Comp, Container>::extractMax() {
+    if (data_.empty())
+        throw std::runtime_error("Tried to extract from an empty heap");
+    return extractAt(maxIndex());
+}
+
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::clear() {
+    data_.clear();
+}
+
+template <typename T, class Comp, class Container>
+size_t MinMaxHeap<T, Comp, Container>::size() const {
+    return data_.size();
+}
+
+template <typename T, class Comp, class Container>
+bool MinMaxHeap<T, Comp, Container>::isEmpty() const {
+    return data_.empty();
+}
+
+// Utility functions
+
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::buildHeap() {  // O(n)
+    if (data_.size() < 2)
+        return;
+
+    for (size_t i = parent(data_.size() - 1) + 1; i > 0; --i)
+        trickleDown(i - 1);
+}
+
+// A new leaf may belong to the levels of the other kind, in which case it is swapped with its parent first
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::bubbleUp(size_t index) {
+    if (index == 0)
+        return;
+
+    size_t parentIndex = parent(index);
+    if (isMinLevel(index)) {
+        if (isBetter<false>(data_[index], data_[parentIndex])) {
+            swap(index, parentIndex);
+            bubbleUpLevels<false>(parentIndex);
+        } else {
+            bubbleUpLevels<true>(index);
+        }
+    } else {
+        if (isBetter<true>(data_[index], data_[parentIndex])) {
+            swap(index, parentIndex);
+            bubbleUpLevels<true>(parentIndex);
+        } else {
+            bubbleUpLevels<false>(index);
+        }
+    }
+}
+
+// Moves the element up through the levels of its kind (every second level)
+template <typename T, class Comp, class Container>
+template <bool IsMinLevel>
+void MinMaxHeap<T, Comp, Container>::bubbleUpLevels(size_t index) {
+    while (index > 2) {
+        size_t grandparent = parent(parent(index));
+        if (!isBetter<IsMinLevel>(data_[index], data_[grandparent]))
+            return;
+
+        swap(index, grandparent);
+        index = grandparent;
+    }
+}
+
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::trickleDown(size_t index) {
+    if (isMinLevel(index))
+        trickleDownLevels<true>(index);
+    else
+        trickleDownLevels<false>(index);
+}
+
+template <typename T, class Comp, class Container>
+template <bool IsMinLevel>
+void MinMaxHeap<T, Comp, Container>::trickleDownLevels(size_t index) {
+    while (firstChild(index) < data_.size()) {
+        // Best element among the children and grandchildren
+        size_t best = firstChild(index);
+        for (size_t child = firstChild(index); child < firstChild(index) + 2 && child < data_.size(); ++child) {
+            if (isBetter<IsMinLevel>(data_[child], data_[best]))
+                best = child;
+
+            for (size_t grandchild = firstChild(child); grandchild < firstChild(child) + 2 && grandchild < data_.size(); ++grandchild) {
+                if (isBetter<IsMinLevel>(data_[grandchild], data_[best]))
+                    best = grandchild;
+            }
+        }
+
+        if (!isBetter<IsMinLevel>(data_[best], data_[index]))
+            return;
+
+        swap(best, index);
+        if (parent(best) == index)  // A child has no descendants that could be violated
+            return;
+
+        if (isBetter<!IsMinLevel>(data_[best], data_[parent(best)]))
+            swap(best, parent(best));
+        index = best;
+    }
+}
+
+template <typename T, class Comp, class Container>
+template <bool IsMinLevel>
+bool MinMaxHeap<T, Comp, Container>::isBetter(const T& first, const T& second) const {
+    if constexpr (IsMinLevel)
+        return comparator_(first, second);
+    else
+        return comparator_(second, first);
+}
+
+template <typename T, class Comp, class Container>
+size_t MinMaxHeap<T, Comp, Container>::maxIndex() const {
+    if (data_.size() == 1)
+        return 0;
+    if (data_.size() == 2 || !comparator_(data_[1], data_[2]))
+        return 1;
+    return 2;
+}
+
+template <typename T, class Comp, class Container>
+T MinMaxHeap<T, Comp, Container>::extractAt(size_t index) {
+    T result = std::move(data_[index]);
+    if (index != data_.size() - 1)
+        data_[index] = std::move(data_.back());
+    data_.pop_back();
+
+    if (index < data_.size())
+        trickleDown(index);
+    return result;
+}
+
+template <typename T, class Comp, class Container>
+bool MinMaxHeap<T, Comp, Container>::isMinLevel(size_t index) {  // Level of index is floor(log2(index + 1))
+    size_t level = 0;
+    for (size_t position = index + 1; position > 1; position >>= 1)
+        ++level;
+    return level % 2 == 0;
+}
+
+template <typename T, class Comp, class Container>
+size_t MinMaxHeap<T, Comp, Container>::parent(size_t index) {
+    return (index - 1) / 2;
+}
+
+template <typename T, class Comp, class Container>
+size_t MinMaxHeap<T, Comp, Container>::firstChild(size_t index) {
+    return 2 * index + 1;
+}
+
+template <typename T, class Comp, class Container>
+void MinMaxHeap<T, Comp, Container>::swap(size_t i1, size_t i2) {
+    T tmp = std::move(data_[i1]);
+    data_[i1] = std::move(data_[i2]);
+    data_[i2] = std::move(tmp);
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Heap.h"
+
+// Relaxed concurrent priority queue made of several Heaps, each protected by its own mutex.
+// insert() puts the key into a random heap and tryExtractExtremum() takes the better extremum of two random heaps,
+// so threads rarely wait for each other. The extracted key is not always the extremum of all keys, but with
+// queuesPerThread * threadCount heaps its expected rank is a small constant.
+template <typename T,
+          class Comp = std::less<T>,
+          size_t Arity = 2>
+class MultiQueue {
+    struct alignas(64) Queue {  // Own cache line, so locking one queue does not slow down its neighbours
+        std::mutex mutex;
+        Heap<T, Comp, std::vector<T>, Arity> heap;
+
+        explicit Queue(const Comp& comp) : heap(comp) {}
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<size_t> size_;
+    const Comp comparator_;
+
+   public:
+    explicit MultiQueue(size_t threadCount, size_t queuesPerThread = 2, const Comp& comp = Comp());
+
+    MultiQueue(const MultiQueue<T, Comp, Arity>&) = delete;
+    MultiQueue<T, Comp, Arity>& operator=(const MultiQueue<T, Comp, Arity>&) = delete;
+
+    void insert(const T& key);
+    void insert(T&& key);
+
+    bool tryExtractExtremum(T& key);  // Returns false if all queues are empty
+
+    size_t size() const;  // Exact while no other thread modifies the queue
+    bool isEmpty() const;
+
+    size_t queueCount() const;
+
+   private:
+    template <typename Key>
+    void insertImpl(Key&& key);
+
+    bool extractFromAny(T& key);
+
+    size_t randomQueue();
+};
+
+// Constructors
+
+template <typename T, class Comp, size_t Arity>
+MultiQueue<T, Comp, Arity>::MultiQueue(size_t threadCount, size_t queuesPerThread, const Comp& comp) : size_(0), comparator_(comp) {
+    size_t queueCount = std::max<size_t>(threadCount * queuesPerThread, 2);
+    queues_.reserve(queueCount);
+    for (size_t i = 0; i < queueCount; ++i)
+        queues_.push_back(std::make_unique<Queue>(comp));
+}
+
+// Insert operations
+
+template <typename T, class Comp, size_t Arity>
+void MultiQueue<T, Comp, Arity>::insert(const T& key) {
+    insertImpl(key);
+}
+
+template <typename T, class Comp, size_t Arity>
+void MultiQueue<T, Comp, Arity>::insert(T&& key) {
+    insertImpl(std::move(key));
+}
+
+// Delete operations
+
+template <typename T, class Comp, size_t Arity>
+bool MultiQueue<T, Comp, Arity>::tryExtractExtremum(T& key) {
+    size_t maxAttempts = 2 * queues_.size();
+    for (size_t attempt = 0; attempt < maxAttempts && size_ > 0; ++attempt) {
+        size_t first = randomQueue();
+        size_t second = (first + 1 + randomQueue() % (queues_.size() - 1)) % queues_.size();  // Any other queue
+
+        std::unique_lock<std::mutex> firstLock(queues_[first]->mutex, std::try_to_lock);
+        if (!firstLock.owns_lock())
+            continue;
+        std::unique_lock<std::mutex> secondLock(queues_[second]->mutex, std::try_to_lock);
+        if (!secondLock.owns_lock())
+            continue;
+
+        auto& firstHeap = queues_[first]->heap;
+        auto& secondHeap = queues_[second]->heap;
+        if (firstHeap.isEmpty() && secondHeap.isEmpty())
+            continue;
+
+        bool takeSecond = firstHeap.isEmpty() || (!secondHeap.isEmpty() && comparator_(secondHeap.extremum(), firstHeap.extremum()));
+        key = takeSecond ? secondHeap.extractExtremum() : firstHeap.extractExtremum();
+        --size_;
+        return true;
+    }
+
+    // Few keys are left (or there is a lot of contention), so random pairs keep missing them
+    return extractFromAny(key);
+}
+
+// Utility functions
+
+template <typename T, class Comp, size_t Arity>
+size_t MultiQueue<T, Comp, Arity>::size() const {
+    return size_;
+}
+
+template <typename T, class Comp, size_t Arity>
+bool MultiQueue<T, Comp, Arity>::isEmpty() const {
+    return size_ == 0;
+}
+
+template <typename T, class Comp, size_t Arity>
+size_t MultiQueue<T, Comp, Arity>::queueCount() const {
+    return queues_.size();
+}
+
+// private utility
+
+template <typename T, class Comp, size_t Arity>
+template <typename Key>
+void MultiQueue<T, Comp, Arity>::insertImpl(Key&& key) {
+    while (true) {
+        Queue& queue = *queues_[randomQueue()];
+        std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            queue.heap.insert(std::forward<Key>(key));
+            ++size_;
+            return;
+        }
+    }
+}
+
+template <typename T, class Comp, size_t Arity>
+bool MultiQueue<T, Comp, Arity>::extractFromAny(T& key) {
+    while (size_ > 0) {
+        for (const std::unique_ptr<Queue>& queue : queues_) {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            if (!queue->heap.isEmpty()) {
+                key = queue->heap.extractExtremum();
+                --size_;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename T, class Comp, size_t Arity>
+size_t MultiQueue<T, Comp, Arity>::randomQueue() {
+    thread_local std::minstd_rand engine(static_cast<unsigned>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+    return engine() % queues_.size();
+}
\ No newline at end of file
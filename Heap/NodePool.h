@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Hands out memory for nodes from blocks of growing size and reuses freed nodes, so node based structures
+// do not call the global allocator for every element and keep their nodes close together.
+// The pool only manages memory, constructing and destroying the nodes is up to its user.
+template <class Node>
+class NodePool {
+    union Slot {
+        Slot* nextFree;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Block {
+        Block* next;
+        Slot* slots;
+        size_t capacity;
+    };
+
+    static constexpr size_t firstBlockSize = 32;
+    static constexpr size_t maxBlockSize = 8192;
+
+    Block* firstBlock_;
+    Block* lastBlock_;
+    Block* currentBlock_;  // Block that new slots are taken from
+    size_t usedSlots_;  // Number of slots of currentBlock_ that were handed out
+
+    Slot* freeHead_;
+    Slot* freeTail_;
+
+   public:
+    NodePool() : firstBlock_(nullptr), lastBlock_(nullptr), currentBlock_(nullptr), usedSlots_(0), freeHead_(nullptr), freeTail_(nullptr) {}
+    NodePool(NodePool<Node>&& other) noexcept;
+    ~NodePool();
+
+    NodePool(const NodePool<Node>&) = delete;
+    NodePool<Node>& operator=(const NodePool<Node>&) = delete;
+    NodePool<Node>& operator=(NodePool<Node>&& other) noexcept;
+
+    void* allocate();  // O(1)
+    void deallocate(void* ptr);  // O(1)
+
+    void adopt(NodePool<Node>& other);  // O(unused slots of one current block), takes over all memory of other
+
+    void clear();  // Frees all blocks, all nodes have to be destroyed before
+
+   private:
+    void addBlock();
+    void releaseUnusedSlots(Block* block, size_t usedSlots);
+};
+
+// Constructors / Destructor
+
+template <class Node>
+NodePool<Node>::NodePool(NodePool<Node>&& other) noexcept : NodePool() {
+    *this = std::move(other);
+}
+
+template <class Node>
+NodePool<Node>::~NodePool() {
+    clear();
+}
+
+template <class Node>
+NodePool<Node>& NodePool<Node>::operator=(NodePool<Node>&& other) noexcept {
+    if (this != &other) {
+        clear();
+        std::swap(firstBlock_, other.firstBlock_);
+        std::swap(lastBlock_, other.lastBlock_);
+        std::swap(currentBlock_, other.currentBlock_);
+        std::swap(usedSlots_, other.usedSlots_);
+        std::swap(freeHead_, other.freeHead_);
+        std::swap(freeTail_, other.freeTail_);
+    }
+    return *this;
+}
+
+// Allocation functions
+
+template <class Node>
+void* NodePool<Node>::allocate() {
+    if (freeHead_ != nullptr) {
+        Slot* slot = freeHead_;
+        freeHead_ = slot->nextFree;
+        if (freeHead_ == nullptr)
+            freeTail_ = nullptr;
+        return slot->storage;
+    }
+
+    if (currentBlock_ == nullptr || usedSlots_ == currentBlock_->capacity)
+        addBlock();
+    return currentBlock_->slots[usedSlots_++].storage;
+}
+
+template <class Node>
+void NodePool<Node>::deallocate(void* ptr) {
+    Slot* slot = static_cast<Slot*>(ptr);
+    slot->nextFree = freeHead_;
+    freeHead_ = slot;
+    if (freeTail_ == nullptr)
+        freeTail_ = slot;
+}
+
+template <class Node>
+void NodePool<Node>::adopt(NodePool<Node>& other) {
+    if (this == &other || other.firstBlock_ == nullptr)
+        return;
+
+    if (lastBlock_ == nullptr) {
+        firstBlock_ = other.firstBlock_;
+        currentBlock_ = other.currentBlock_;
+        usedSlots_ = other.usedSlots_;
+    } else {
+        // Only one block hands out new slots, so the unused slots of the block with fewer of them become free slots
+        if (other.currentBlock_->capacity - other.usedSlots_ > currentBlock_->capacity - usedSlots_) {
+            std::swap(currentBlock_, other.currentBlock_);
+            std::swap(usedSlots_, other.usedSlots_);
+        }
+        releaseUnusedSlots(other.currentBlock_, other.usedSlots_);
+        lastBlock_->next = other.firstBlock_;
+    }
+    lastBlock_ = other.lastBlock_;
+
+    if (other.freeHead_ != nullptr) {
+        other.freeTail_->nextFree = freeHead_;
+        if (freeTail_ == nullptr)
+            freeTail_ = other.freeTail_;
+        freeHead_ = other.freeHead_;
+    }
+
+    other.firstBlock_ = other.lastBlock_ = other.currentBlock_ = nullptr;
+    other.usedSlots_ = 0;
+    other.freeHead_ = other.freeTail_ = nullptr;
+}
+
+template <class Node>
+void NodePool<Node>::clear() {
+    while (firstBlock_ != nullptr) {
+        Block* next = firstBlock_->next;
+        delete[] firstBlock_->slots;
+        delete firstBlock_;
+        firstBlock_ = next;
+    }
+
+    lastBlock_ = currentBlock_ = nullptr;
+    usedSlots_ = 0;
+    freeHead_ = freeTail_ = nullptr;
+}
+
+// private utility
+
+template <class Node>
+void NodePool<Node>::addBlock() {
+    size_t capacity = currentBlock_ == nullptr ? firstBlockSize : std::min(2 * currentBlock_->capacity, maxBlockSize);
+
+    Block* block = new Block{nullptr, nullptr, capacity};
+    try {
+        block->slots = new Slot[capacity];
+    } catch (...) {
+        delete block;
+        throw;
+    }
+
+    if (lastBlock_ == nullptr)
+        firstBlock_ = block;
+    else
+        lastBlock_->next = block;
+    lastBlock_ = block;
+
+    currentBlock_ = block;
+    usedSlots_ = 0;
+}
+
+template <class Node>
+void NodePool<Node>::releaseUnusedSlots(Block* block, size_t usedSlots) {
+    for (size_t i = block->capacity; i > usedSlots; --i)  // Backwards, so they are handed out in address order
+        deallocate(block->slots[i - 1].storage);
+}
\ No newline at end of file
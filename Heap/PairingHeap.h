@@ -0,0 +1,297 @@
+#pragma once
+
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "NodePool.h"
+
+// Heap ordered multiway tree, that links trees in O(1), which makes insert() and meld() O(1).
+// extractExtremum() pairs up the children of the root (amortized O(log n)) and decreaseKey() cuts the subtree of
+// the element and links it with the root (amortized o(log n), O(1) in practice).
+// Nodes come from a NodePool and are never copied, so handles stay valid until their element is extracted
+// (even when the heap is melded into another one).
+template <typename T, class Comp = std::less<T>>
+class PairingHeap {
+    struct Node {
+        T key;
+        Node* child;  // Leftmost child
+        Node* sibling;  // Next sibling to the right
+        Node* prev;  // Previous sibling, or the parent if this is the leftmost child
+
+        template <typename... Args>
+        explicit Node(Args&&... args) : key(std::forward<Args>(args)...), child(nullptr), sibling(nullptr), prev(nullptr) {}
+    };
+
+    NodePool<Node> pool_;
+    Node* root_;
+    size_t size_;
+    const Comp comparator_;
+
+   public:
+    class handle {
+        Node* node_;
+
+        friend class PairingHeap<T, Comp>;
+
+        explicit handle(Node* node) : node_(node) {}
+
+       public:
+        handle() : node_(nullptr) {}
+
+        bool operator==(const handle& other) const {
+            return node_ == other.node_;
+        }
+
+        bool operator!=(const handle& other) const {
+            return node_ != other.node_;
+        }
+    };
+
+    explicit PairingHeap(const Comp& comp = Comp()) : root_(nullptr), size_(0), comparator_(comp) {}
+    PairingHeap(PairingHeap<T, Comp>&& heap) noexcept;
+    ~PairingHeap();
+
+    PairingHeap(const PairingHeap<T, Comp>&) = delete;
+    PairingHeap<T, Comp>& operator=(const PairingHeap<T, Comp>&) = delete;
+
+    handle insert(const T& key);  // O(1)
+    handle insert(T&& key);  // O(1)
+    template <typename... Args>
+    handle emplace(Args&&... args);  // O(1)
+
+    void meld(PairingHeap<T, Comp>&& other);  // O(1)
+
+    const T& extremum() const;
+    T extractExtremum();  // amortized O(log n)
+
+    const T& key(handle h) const;
+    void decreaseKey(handle h, const T& key);  // Moves the key towards the extremum, amortized o(log n)
+
+    void clear();  // O(n)
+
+    size_t size() const;
+    bool isEmpty() const;
+
+   private:
+    template <typename... Args>
+    Node* createNode(Args&&... args);
+    void destroyNode(Node* node);
+
+    Node* link(Node* first, Node* second);
+    Node* mergePairs(Node* firstChild);
+    void cut(Node* node);
+};
+
+// Constructors / Destructor
+
+template <typename T, class Comp>
+PairingHeap<T, Comp>::PairingHeap(PairingHeap<T, Comp>&& heap) noexcept
+    : pool_(std::move(heap.pool_)), root_(heap.root_), size_(heap.size_), comparator_(std::move(heap.comparator_)) {
+    heap.root_ = nullptr;
+    heap.size_ = 0;
+}
+
+template <typename T, class Comp>
+PairingHeap<T, Comp>::~PairingHeap() {
+    clear();
+}
+
+// Insert operations
+
+template <typename T, class Comp>
+typename PairingHeap<T, Comp>::handle PairingHeap<T, Comp>::insert(const T& key) {
+    return emplace(key);
+}
+
+template <typename T, class Comp>
+typename PairingHeap<T, Comp>::handle PairingHeap<T, Comp>::insert(T&& key) {
+    return emplace(std::move(key));
+}
+
+template <typename T, class Comp>
+template <typename... Args>
+typename PairingHeap<T, Comp>::handle PairingHeap<T, Comp>::emplace(Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    root_ = link(root_, node);
+    ++size_;
+    return handle(node);
+}
+
+// Moves all elements of other into this heap. Handles to elements of other stay valid.
+template <typename T, class Comp>
+void PairingHeap<T, Comp>::meld(PairingHeap<T, Comp>&& other) {
+    if (this == &other)
+        return;
+
+    pool_.adopt(other.pool_);
+    root_ = link(root_, other.root_);
+    size_ += other.size_;
+
+    other.root_ = nullptr;
+    other.size_ = 0;
+}
+
+// Access and delete operations
+
+template <typename T, class Comp>
+const T& PairingHeap<T, Comp>::extremum() const {
+    if (root_ == nullptr)
+        throw std::runtime_error("Heap is empty");
+    return root_->key;
+}
+
+template <typename T, class Comp>
+T PairingHeap<T, Comp>::extractExtremum() {
+    if (root_ == nullptr)
+        throw std::runtime_error("Tried to extract from an empty heap");
+
+    Node* oldRoot = root_;
+    T result = std::move(oldRoot->key);
+    root_ = mergePairs(oldRoot->child);
+    --size_;
+
+    destroyNode(oldRoot);
+    return result;
+}
+
+template <typename T, class Comp>
+const T& PairingHeap<T, Comp>::key(handle h) const {
+    return h.node_->key;
+}
+
+template <typename T, class Comp>
+void PairingHeap<T, Comp>::decreaseKey(handle h, const T& key) {
+    Node* node = h.node_;
+    if (comparator_(node->key, key))
+        throw std::runtime_error("decreaseKey() would move the key away from the extremum");
+
+    node->key = key;
+    if (node != root_) {
+        cut(node);
+        root_ = link(root_, node);
+    }
+}
+
+// Destroys the nodes without recursion, because the trees can be very deep
+template <typename T, class Comp>
+void PairingHeap<T, Comp>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        std::vector<Node*> stack;
+        if (root_ != nullptr)
+            stack.push_back(root_);
+
+        while (!stack.empty()) {
+            Node* node = stack.back();
+            stack.pop_back();
+            if (node->child != nullptr)
+                stack.push_back(node->child);
+            if (node->sibling != nullptr)
+                stack.push_back(node->sibling);
+            node->~Node();
+        }
+    }
+
+    pool_.clear();
+    root_ = nullptr;
+    size_ = 0;
+}
+
+template <typename T, class Comp>
+size_t PairingHeap<T, Comp>::size() const {
+    return size_;
+}
+
+template <typename T, class Comp>
+bool PairingHeap<T, Comp>::isEmpty() const {
+    return size_ == 0;
+}
+
+// private utility
+
+template <typename T, class Comp>
+template <typename... Args>
+typename PairingHeap<T, Comp>::Node* PairingHeap<T, Comp>::createNode(Args&&... args) {
+    void* memory = pool_.allocate();
+    try {
+        return new (memory) Node(std::forward<Args>(args)...);
+    } catch (...) {
+        pool_.deallocate(memory);
+        throw;
+    }
+}
+
+template <typename T, class Comp>
+void PairingHeap<T, Comp>::destroyNode(Node* node) {
+    node->~Node();
+    pool_.deallocate(node);
+}
+
+// Makes the root with the worse key the leftmost child of the other one and returns the new root
+template <typename T, class Comp>
+typename PairingHeap<T, Comp>::Node* PairingHeap<T, Comp>::link(Node* first, Node* second) {
+    if (first == nullptr)
+        return second;
+    if (second == nullptr)
+        return first;
+
+    if (comparator_(second->key, first->key))
+        std::swap(first, second);
+
+    second->prev = first;
+    second->sibling = first->child;
+    if (first->child != nullptr)
+        first->child->prev = second;
+    first->child = second;
+
+    first->prev = nullptr;
+    first->sibling = nullptr;
+    return first;
+}
+
+// Two pass pairing: links the siblings in pairs from left to right, then links the pairs from right to left
+template <typename T, class Comp>
+typename PairingHeap<T, Comp>::Node* PairingHeap<T, Comp>::mergePairs(Node* firstChild) {
+    Node* pairs = nullptr;  // Linked pairs, the rightmost first (chained through sibling)
+    Node* it = firstChild;
+    while (it != nullptr) {
+        Node* first = it;
+        Node* second = first->sibling;
+        it = second == nullptr ? nullptr : second->sibling;
+
+        first->sibling = nullptr;
+        if (second != nullptr)
+            second->sibling = nullptr;
+
+        Node* pair = link(first, second);
+        pair->prev = nullptr;
+        pair->sibling = pairs;
+        pairs = pair;
+    }
+
+    Node* result = nullptr;
+    while (pairs != nullptr) {
+        Node* next = pairs->sibling;
+        pairs->sibling = nullptr;
+        result = link(result, pairs);
+        pairs = next;
+    }
+    return result;
+}
+
+// Removes the subtree of node from its parent
+template <typename T, class Comp>
+void PairingHeap<T, Comp>::cut(Node* node) {
+    if (node->prev->child == node)
+        node->prev->child = node->sibling;
+    else
+        node->prev->sibling = node->sibling;
+
+    if (node->sibling != nullptr)
+        node->sibling->prev = node->prev;
+
+    node->prev = nullptr;
+    node->sibling = nullptr;
+}
\ No newline at end of file
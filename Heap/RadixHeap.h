@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Monotone priority queue for unsigned integer keys, each with an attached value.
+// Keys may not be smaller than the last extracted key (as in Dijkstra's algorithm or timer queues).
+// Bucket i holds the keys whose highest bit that differs from the last extracted key is bit i - 1 (bucket 0 the
+// keys equal to it). extractMin() empties the first non empty bucket into lower buckets, and as a key can only move
+// down, every key is moved at most once per bit, which makes the operations amortized O(log C).
+// The buckets are vectors, so these moves are sequential.
+template <typename Key, typename Value>
+class RadixHeap {
+    static_assert(std::is_unsigned<Key>::value, "RadixHeap needs an unsigned integer key type");
+
+    static constexpr size_t bucketCount = std::numeric_limits<Key>::digits + 1;
+
+    std::array<std::vector<std::pair<Key, Value>>, bucketCount> buckets_;
+    std::array<Key, bucketCount> bucketMin_;  // Smallest key in every bucket
+    Key last_;  // Last extracted key, which the buckets are relative to (only extractMin() changes it)
+    size_t size_;
+
+   public:
+    RadixHeap();
+
+    void insert(Key key, const Value& value);  // O(1)
+    void insert(Key key, Value&& value);  // O(1)
+
+    Key minKey() const;  // O(log C), only looks at the bucket minima
+    std::pair<Key, Value> extractMin();  // amortized O(log C)
+
+    void clear();
+
+    size_t size() const;
+    bool isEmpty() const;
+
+   private:
+    size_t bucketIndex(Key key) const;
+    void pushToBucket(std::pair<Key, Value>&& entry);
+    void refill();
+};
+
+// Constructors
+
+template <typename Key, typename Value>
+RadixHeap<Key, Value>::RadixHeap() : last_(0), size_(0) {
+    bucketMin_.fill(std::numeric_limits<Key>::max());
+}
+
+// Insert operations
+
+template <typename Key, typename Value>
+void RadixHeap<Key, Value>::insert(Key key, const Value& value) {
+    insert(key, Value(value));
+}
+
+template <typename Key, typename Value>
+void RadixHeap<Key, Value>::insert(Key key, Value&& value) {
+    if (key < last_)
+        throw std::runtime_error("Key is smaller than the last extracted key");
+
+    pushToBucket(std::pair<Key, Value>(key, std::move(value)));
+    ++size_;
+}
+
+// Access and delete operations
+
+// Does not redistribute a bucket, as that would make the minimum the new base of the buckets and reject keys
+// between the last extracted key and the minimum, which may still be inserted
+template <typename Key, typename Value>
+Key RadixHeap<Key, Value>::minKey() const {
+    if (size_ == 0)
+        throw std::runtime_error("Heap is empty");
+    if (!buckets_[0].empty())
+        return last_;
+
+    size_t index = 1;
+    while (buckets_[index].empty())
+        ++index;
+    return bucketMin_[index];
+}
+
+template <typename Key, typename Value>
+std::pair<Key, Value> RadixHeap<Key, Value>::extractMin() {
+    refill();
+
+    std::pair<Key, Value> result = std::move(buckets_[0].back());
+    buckets_[0].pop_back();
+    --size_;
+    return result;
+}
+
+template <typename Key, typename Value>
+void RadixHeap<Key, Value>::clear() {
+    for (auto& bucket : buckets_)
+        bucket.clear();
+    bucketMin_.fill(std::numeric_limits<Key>::max());
+    last_ = 0;
+    size_ = 0;
+}
+
+template <typename Key, typename Value>
+size_t RadixHeap<Key, Value>::size() const {
+    return size_;
+}
+
+template <typename Key, typename Value>
+bool RadixHeap<Key, Value>::isEmpty() const {
+    return size_ == 0;
+}
+
+// private utility
+
+template <typename Key, typename Value>
+size_t RadixHeap<Key, Value>::bucketIndex(Key key) const {  // Number of significant bits of key ^ last_
+    unsigned long long diff = static_cast<unsigned long long>(key ^ last_);
+    if (diff == 0)
+        return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return std::numeric_limits<unsigned long long>::digits - __builtin_clzll(diff);
+#else
+    size_t bits = 0;
+    while (diff != 0) {
+        diff >>= 1;
+        ++bits;
+    }
+    return bits;
+#endif
+}
+
+template <typename Key, typename Value>
+void RadixHeap<Key, Value>::pushToBucket(std::pair<Key, Value>&& entry) {
+    size_t index = bucketIndex(entry.first);
+    if (entry.first < bucketMin_[index])
+        bucketMin_[index] = entry.first;
+    buckets_[index].push_back(std::move(entry));
+}
+
+// Makes sure bucket 0 holds the smallest keys, by redistributing the first non empty bucket relative to its minimum
+template <typename Key, typename Value>
+void RadixHeap<Key, Value>::refill() {
+    if (size_ == 0)
+        throw std::runtime_error("Heap is empty");
+    if (!buckets_[0].empty())
+        return;
+
+    size_t index = 1;
+    while (buckets_[index].empty())
+        ++index;
+
+    last_ = bucketMin_[index];
+    for (std::pair<Key, Value>& entry : buckets_[index])
+        pushToBucket(std::move(entry));  // Always into a lower bucket
+
+    buckets_[index].clear();
+    bucketMin_[index] = std::numeric_limits<Key>::max();
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HEAP_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// Finds the extremal key among the 8 or 16 children of a node in a wide heap of 32 bit keys (uint32_t, int32_t or float)
+// with AVX2 min/max instructions. Whether the CPU supports AVX2 is checked at runtime, select() returns npos if it
+// does not (or if the keys cannot be ordered, like NaNs), and the caller has to fall back to scalar comparisons.
+// Ties are resolved like the scalar loop, by taking the first extremal child.
+template <typename T, class Comp>
+struct SimdChildSelector {
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    static constexpr bool isMin = std::is_same<Comp, std::less<T>>::value;
+    static constexpr bool isMax = std::is_same<Comp, std::greater<T>>::value;
+
+#ifdef HEAP_SIMD_X86
+    static constexpr bool enabled = (isMin || isMax) &&
+                                    (std::is_same<T, uint32_t>::value || std::is_same<T, int32_t>::value || std::is_same<T, float>::value);
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    static size_t select(const T* keys, size_t count);
+
+#ifdef HEAP_SIMD_X86
+   private:
+    static bool hasAvx2();
+
+    __attribute__((target("avx2"))) static size_t select8(const T* keys);
+    __attribute__((target("avx2"))) static size_t select16(const T* keys);
+
+    __attribute__((target("avx2"))) static __m256 load(const T* keys);
+    __attribute__((target("avx2"))) static __m256 extremum(__m256 first, __m256 second);
+    __attribute__((target("avx2"))) static __m256 broadcastExtremum(__m256 keys);
+    __attribute__((target("avx2"))) static int equalMask(__m256 keys, __m256 value);
+#endif
+};
+
+// Containers whose elements are contiguous in memory, so the children of a node can be loaded at once
+template <class Container>
+struct IsContiguousContainer : std::false_type {};
+
+template <typename T, class Allocator>
+struct IsContiguousContainer<std::vector<T, Allocator>> : std::true_type {};
+
+template <typename T, class Comp>
+size_t SimdChildSelector<T, Comp>::select(const T* keys, size_t count) {
+#ifdef HEAP_SIMD_X86
+    if constexpr (enabled) {
+        if (hasAvx2()) {
+            if (count == 8)
+                return select8(keys);
+            if (count == 16)
+                return select16(keys);
+        }
+    }
+#endif
+    (void)keys;
+    (void)count;
+    return npos;
+}
+
+#ifdef HEAP_SIMD_X86
+
+template <typename T, class Comp>
+bool SimdChildSelector<T, Comp>::hasAvx2() {
+    static const bool result = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return result;
+}
+
+template <typename T, class Comp>
+size_t SimdChildSelector<T, Comp>::select8(const T* keys) {
+    __m256 values = load(keys);
+    int mask = equalMask(values, broadcastExtremum(values));
+    return mask == 0 ? npos : __builtin_ctz(mask);
+}
+
+template <typename T, class Comp>
+size_t SimdChildSelector<T, Comp>::select16(const T* keys) {
+    __m256 low = load(keys);
+    __m256 high = load(keys + 8);
+    __m256 value = broadcastExtremum(extremum(low, high));
+    int mask = equalMask(low, value) | (equalMask(high, value) << 8);
+    return mask == 0 ? npos : __builtin_ctz(mask);
+}
+
+// The integer keys are kept in float registers (only reinterpreted), so all types can share the shuffles
+
+template <typename T, class Comp>
+__m256 SimdChildSelector<T, Comp>::load(const T* keys) {
+    return _mm256_loadu_ps(reinterpret_cast<const float*>(keys));
+}
+
+template <typename T, class Comp>
+__m256 SimdChildSelector<T, Comp>::extremum(__m256 first, __m256 second) {
+    if constexpr (std::is_same<T, float>::value) {
+        return isMin ? _mm256_min_ps(first, second) : _mm256_max_ps(first, second);
+    } else {
+        __m256i a = _mm256_castps_si256(first);
+        __m256i b = _mm256_castps_si256(second);
+        __m256i result;
+        if constexpr (std::is_same<T, uint32_t>::value)
+            result = isMin ? _mm256_min_epu32(a, b) : _mm256_max_epu32(a, b);
+        else
+            result = isMin ? _mm256_min_epi32(a, b) : _mm256_max_epi32(a, b);
+        return _mm256_castsi256_ps(result);
+    }
+}
+
+template <typename T, class Comp>
+__m256 SimdChildSelector<T, Comp>::broadcastExtremum(__m256 keys) {  // Every lane ends up with the extremum of all lanes
+    keys = extremum(keys, _mm256_permute2f128_ps(keys, keys, 1));
+    keys = extremum(keys, _mm256_shuffle_ps(keys, keys, _MM_SHUFFLE(1, 0, 3, 2)));
+    return extremum(keys, _mm256_shuffle_ps(keys, keys, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+template <typename T, class Comp>
+int SimdChildSelector<T, Comp>::equalMask(__m256 keys, __m256 value) {
+    if constexpr (std::is_same<T, float>::value) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(keys, value, _CMP_EQ_OQ));
+    } else {
+        __m256i equal = _mm256_cmpeq_epi32(_mm256_castps_si256(keys), _mm256_castps_si256(value));
+        return _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+    }
+}
+
+#endif
\ No newline at end of file
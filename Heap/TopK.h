@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Heap.h"
+
+#include "../Utility/RunParallel.h"
+
+// Keeps the k largest elements (according to Comp) of a stream.
+// The kept elements are in a Heap whose extremum is the smallest of them, the threshold a new element has to beat,
+// so an element that does not qualify is rejected after one comparison.
+template <typename T, class Comp = std::less<T>>
+class TopK {
+    Heap<T, Comp> heap_;
+    size_t capacity_;
+    const Comp comparator_;
+
+   public:
+    explicit TopK(size_t k, const Comp& comp = Comp());
+
+    bool insert(const T& key);  // O(1) if key is rejected, O(log k) otherwise, returns whether key was kept
+    bool insert(T&& key);
+
+    void merge(TopK<T, Comp>&& other);  // O(k log k)
+
+    const T& threshold() const;  // Smallest kept element
+    std::vector<T> extractSorted();  // O(k log k), largest first, leaves the selector empty
+
+    template <class RandomIt>
+    static TopK<T, Comp> parallelSelect(RandomIt first, RandomIt last, size_t k, size_t threadCount = 0, const Comp& comp = Comp());
+
+    void clear();
+
+    size_t size() const;
+    size_t capacity() const;
+    bool isFull() const;
+
+   private:
+    template <typename Key>
+    bool insertImpl(Key&& key);
+};
+
+// Constructors
+
+template <typename T, class Comp>
+TopK<T, Comp>::TopK(size_t k, const Comp& comp) : heap_(comp), capacity_(k), comparator_(comp) {
+    if (k == 0)
+        throw std::runtime_error("TopK needs a capacity of at least 1");
+}
+
+// Insert operations
+
+template <typename T, class Comp>
+bool TopK<T, Comp>::insert(const T& key) {
+    return insertImpl(key);
+}
+
+template <typename T, class Comp>
+bool TopK<T, Comp>::insert(T&& key) {
+    return insertImpl(std::move(key));
+}
+
+template <typename T, class Comp>
+void TopK<T, Comp>::merge(TopK<T, Comp>&& other) {
+    while (!other.heap_.isEmpty())
+        insert(other.heap_.extractExtremum());
+}
+
+// Access functions
+
+template <typename T, class Comp>
+const T& TopK<T, Comp>::threshold() const {
+    return heap_.extremum();
+}
+
+template <typename T, class Comp>
+std::vector<T> TopK<T, Comp>::extractSorted() {
+    std::vector<T> result;
+    result.reserve(heap_.size());
+    while (!heap_.isEmpty())
+        result.push_back(heap_.extractExtremum());
+
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+// Splits [first, last) into one part per thread, selects the top k of every part in its own thread and merges the results
+template <typename T, class Comp>
+template <class RandomIt>
+TopK<T, Comp> TopK<T, Comp>::parallelSelect(RandomIt first, RandomIt last, size_t k, size_t threadCount, const Comp& comp) {
+    size_t count = std::distance(first, last);
+    threadCount = std::max<size_t>(std::min(resolveThreadCount(threadCount), count / k), 1);  // Parts smaller than k save nothing
+
+    std::vector<TopK<T, Comp>> selectors;
+    selectors.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+        selectors.emplace_back(k, comp);
+
+    auto selectPart = [&](size_t part) {
+        RandomIt partFirst = first + count * part / threadCount;
+        RandomIt partLast = first + count * (part + 1) / threadCount;
+        for (RandomIt it = partFirst; it != partLast; ++it)
+            selectors[part].insert(*it);
+    };
+
+    runParallel(threadCount, threadCount, selectPart);
+
+    for (size_t i = 1; i < threadCount; ++i)
+        selectors[0].merge(std::move(selectors[i]));
+    return std::move(selectors[0]);
+}
+
+// Utility functions
+
+template <typename T, class Comp>
+void TopK<T, Comp>::clear() {
+    heap_.clear();
+}
+
+template <typename T, class Comp>
+size_t TopK<T, Comp>::size() const {
+    return heap_.size();
+}
+
+template <typename T, class Comp>
+size_t TopK<T, Comp>::capacity() const {
+    return capacity_;
+}
+
+template <typename T, class Comp>
+bool TopK<T, Comp>::isFull() const {
+    return heap_.size() == capacity_;
+}
+
+// private utility
+
+template <typename T, class Comp>
+template <typename Key>
+bool TopK<T, Comp>::insertImpl(Key&& key) {
+    if (heap_.size() < capacity_) {
+        heap_.insert(std::forward<Key>(key));
+        return true;
+    }
+
+    if (!comparator_(heap_.extremum(), key))
+        return false;
+
+    heap_.replaceExtremum(std::forward<Key>(key));
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "IntrusiveListHook.h"
+#include "IntrusiveListIt.h"
+
+// Doubly linked list of objects that derive from IntrusiveListHook<Tag>. The list links the objects themselves
+// instead of copying them into nodes, so it never allocates and does not own its elements: they have to outlive
+// their membership, and an element can leave its list in O(1) with unlink() or by being destroyed.
+// The hooks form a ring around a sentinel hook owned by the list, so no operation has to handle head or tail separately.
+template <typename T, class Tag = void>
+class IntrusiveList {
+    using Hook = IntrusiveListHook<Tag>;
+
+    Hook root_;  // Sentinel, root_.next_ is the first and root_.prev_ the last element
+
+   public:
+    using iterator = IntrusiveListIt<T, Tag>;
+
+    IntrusiveList();
+    IntrusiveList(const IntrusiveList<T, Tag>&) = delete;
+    IntrusiveList(IntrusiveList<T, Tag>&& lst) noexcept;
+    ~IntrusiveList();
+
+    IntrusiveList<T, Tag>& operator=(const IntrusiveList<T, Tag>&) = delete;
+    IntrusiveList<T, Tag>& operator=(IntrusiveList<T, Tag>&& lst) noexcept;
+
+    void append(T& key);  // O(1)
+    void insert(T& key, iterator position);  // O(1)
+
+    void erase(iterator position);  // O(1), unlinks the element without destroying it
+    void erase(iterator start, iterator end);  // O(number of erased elements), every hook has to be reset
+
+    // Moves all elements or the elements [first, last) of other in front of position, which may not lie in that range
+    void splice(iterator position, IntrusiveList<T, Tag>& other);  // O(1)
+    void splice(iterator position, IntrusiveList<T, Tag>& other, iterator first, iterator last);  // O(1)
+
+    int computeSize() const;  // O(n)
+    bool isEmpty() const;
+    void clear();  // O(n)
+
+    iterator begin();
+    iterator end();
+    iterator begin() const;
+    iterator end() const;
+    iterator cbegin() const;
+    iterator cend() const;
+
+   private:
+    void takeOver(IntrusiveList<T, Tag>& lst);
+    static void link(Hook* node, Hook* position);  // Links node in front of position
+};
+
+// Constructors
+
+template <typename T, class Tag>
+IntrusiveList<T, Tag>::IntrusiveList() {
+    root_.sentinel_ = true;
+    root_.next_ = &root_;
+    root_.prev_ = &root_;
+}
+
+template <typename T, class Tag>
+IntrusiveList<T, Tag>::IntrusiveList(IntrusiveList<T, Tag>&& lst) noexcept : IntrusiveList() {
+    takeOver(lst);
+}
+
+template <typename T, class Tag>
+IntrusiveList<T, Tag>::~IntrusiveList() {
+    clear();
+}
+
+// Assignment operators
+
+template <typename T, class Tag>
+IntrusiveList<T, Tag>& IntrusiveList<T, Tag>::operator=(IntrusiveList<T, Tag>&& lst) noexcept {
+    if (this != &lst) {
+        clear();
+        takeOver(lst);
+    }
+    return *this;
+}
+
+// Insertion functions
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::append(T& key) {
+    insert(key, end());
+}
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::insert(T& key, iterator position) {
+    Hook* node = &key;
+    if (node->isLinked())
+        throw std::runtime_error("Element is already in a list");
+    link(node, position.currentNode_);
+}
+
+// Deletion functions
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::erase(iterator position) {
+    if (position.isValid())
+        position.currentNode_->unlink();
+}
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::erase(iterator start, iterator end) {
+    while (start != end) {
+        Hook* node = start.currentNode_;
+        ++start;
+        node->unlink();
+    }
+}
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::splice(iterator position, IntrusiveList<T, Tag>& other) {
+    splice(position, other, other.begin(), other.end());
+}
+
+// The hooks link to their neighbours directly, so the source list itself is not needed
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::splice(iterator position, IntrusiveList<T, Tag>& /* other */, iterator first, iterator last) {
+    if (first == last)
+        return;
+
+    Hook* firstNode = first.currentNode_;
+    Hook* lastNode = last.currentNode_->prev_;  // Last element that is moved
+
+    firstNode->prev_->next_ = last.currentNode_;
+    last.currentNode_->prev_ = firstNode->prev_;
+
+    Hook* next = position.currentNode_;
+    firstNode->prev_ = next->prev_;
+    next->prev_->next_ = firstNode;
+    lastNode->next_ = next;
+    next->prev_ = lastNode;
+}
+
+// Utility functions
+
+template <typename T, class Tag>
+int IntrusiveList<T, Tag>::computeSize() const {
+    int result = 0;
+    for (const Hook* node = root_.next_; node != &root_; node = node->next_)
+        ++result;
+
+    return result;
+}
+
+template <typename T, class Tag>
+bool IntrusiveList<T, Tag>::isEmpty() const {
+    return root_.next_ == &root_;
+}
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::clear() {
+    while (!isEmpty())
+        root_.next_->unlink();
+}
+
+// begin / end functions
+
+template <typename T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::begin() {
+    return iterator(root_.next_);
+}
+
+template <typename T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::end() {
+    return iterator(&root_);
+}
+
+template <typename T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::begin() const {
+    return cbegin();
+}
+
+template <typename T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::end() const {
+    return cend();
+}
+
+template <typename T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::cbegin() const {
+    return iterator(root_.next_);
+}
+
+template <typename T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::cend() const {
+    return iterator(const_cast<Hook*>(&root_));
+}
+
+// private utility
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::takeOver(IntrusiveList<T, Tag>& lst) {
+    if (lst.isEmpty())
+        return;
+
+    root_.next_ = lst.root_.next_;
+    root_.prev_ = lst.root_.prev_;
+    root_.next_->prev_ = &root_;
+    root_.prev_->next_ = &root_;
+
+    lst.root_.next_ = &lst.root_;
+    lst.root_.prev_ = &lst.root_;
+}
+
+template <typename T, class Tag>
+void IntrusiveList<T, Tag>::link(Hook* node, Hook* position) {
+    node->next_ = position;
+    node->prev_ = position->prev_;
+    position->prev_->next_ = node;
+    position->prev_ = node;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+template <typename T, class Tag>
+class IntrusiveList;
+
+template <typename T, class Tag>
+class IntrusiveListIt;
+
+// Links an object into an IntrusiveList. A type that should be kept in such a list derives publicly from a hook,
+// one for every list it can be in at the same time, told apart by the Tag.
+// The hook unlinks the object when it is destroyed, and copying an object does not copy its links.
+template <class Tag = void>
+class IntrusiveListHook {
+    IntrusiveListHook<Tag>* next_;
+    IntrusiveListHook<Tag>* prev_;
+    bool sentinel_;  // Only set for the hook a list owns, so iterators can find the end of whatever list they are in
+
+    template <typename, class>
+    friend class IntrusiveList;
+    template <typename, class>
+    friend class IntrusiveListIt;
+
+   public:
+    IntrusiveListHook() : next_(nullptr), prev_(nullptr), sentinel_(false) {}
+    IntrusiveListHook(const IntrusiveListHook<Tag>&) : IntrusiveListHook() {}
+    ~IntrusiveListHook();
+
+    IntrusiveListHook<Tag>& operator=(const IntrusiveListHook<Tag>&);
+
+    bool isLinked() const;
+    void unlink();  // O(1), removes the object from its list without knowing the list
+};
+
+// Constructors
+
+template <class Tag>
+IntrusiveListHook<Tag>::~IntrusiveListHook() {
+    unlink();
+}
+
+// Assignment operators
+
+template <class Tag>
+IntrusiveListHook<Tag>& IntrusiveListHook<Tag>::operator=(const IntrusiveListHook<Tag>&) {  // Keeps the own links
+    return *this;
+}
+
+// Utility functions
+
+template <class Tag>
+bool IntrusiveListHook<Tag>::isLinked() const {
+    return next_ != nullptr;
+}
+
+template <class Tag>
+void IntrusiveListHook<Tag>::unlink() {
+    if (next_ == nullptr)
+        return;
+
+    next_->prev_ = prev_;
+    prev_->next_ = next_;
+    next_ = nullptr;
+    prev_ = nullptr;
+}
\ No newline at end of file
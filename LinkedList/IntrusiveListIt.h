@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+#include "IntrusiveListHook.h"
+
+// Iterator over the hooks of an IntrusiveList. The list is circular around a sentinel hook, which is the end.
+// Sentinels are marked on the hook itself, so an iterator stays usable after its elements were spliced into another list
+template <typename T, class Tag>
+class IntrusiveListIt {
+    IntrusiveListHook<Tag>* currentNode_;
+
+    friend class IntrusiveList<T, Tag>;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    IntrusiveListIt() : currentNode_(nullptr) {}
+    explicit IntrusiveListIt(IntrusiveListHook<Tag>* node) : currentNode_(node) {}
+
+    IntrusiveListIt<T, Tag>& operator++();
+    IntrusiveListIt<T, Tag>& operator--();  // Decrementing end gives the last element
+
+    IntrusiveListIt<T, Tag> next() const;
+    IntrusiveListIt<T, Tag> prev() const;
+
+    bool isValid() const;
+
+    T& operator*() const;
+    T* operator->() const;
+
+    bool operator==(const IntrusiveListIt<T, Tag>& other) const;
+    bool operator!=(const IntrusiveListIt<T, Tag>& other) const;
+};
+
+// Increment / Decrement operators
+
+template <typename T, class Tag>
+IntrusiveListIt<T, Tag>& IntrusiveListIt<T, Tag>::operator++() {
+    if (!isValid())
+        throw std::runtime_error("Tried to increment invalid iterator");
+    currentNode_ = currentNode_->next_;
+    return *this;
+}
+
+template <typename T, class Tag>
+IntrusiveListIt<T, Tag>& IntrusiveListIt<T, Tag>::operator--() {
+    if (currentNode_ == nullptr)
+        throw std::runtime_error("Tried to decrement invalid iterator");
+    currentNode_ = currentNode_->prev_;
+    return *this;
+}
+
+template <typename T, class Tag>
+IntrusiveListIt<T, Tag> IntrusiveListIt<T, Tag>::next() const {
+    IntrusiveListIt<T, Tag> result = *this;
+    return ++result;
+}
+
+template <typename T, class Tag>
+IntrusiveListIt<T, Tag> IntrusiveListIt<T, Tag>::prev() const {
+    IntrusiveListIt<T, Tag> result = *this;
+    return --result;
+}
+
+template <typename T, class Tag>
+bool IntrusiveListIt<T, Tag>::isValid() const {
+    return currentNode_ != nullptr && !currentNode_->sentinel_;
+}
+
+// Dereference operators
+
+template <typename T, class Tag>
+T& IntrusiveListIt<T, Tag>::operator*() const {
+    return static_cast<T&>(*currentNode_);
+}
+
+template <typename T, class Tag>
+T* IntrusiveListIt<T, Tag>::operator->() const {
+    return static_cast<T*>(currentNode_);
+}
+
+// Comparision operators
+
+template <typename T, class Tag>
+bool IntrusiveListIt<T, Tag>::operator==(const IntrusiveListIt<T, Tag>& other) const {
+    return currentNode_ == other.currentNode_;
+}
+
+template <typename T, class Tag>
+bool IntrusiveListIt<T, Tag>::operator!=(const IntrusiveListIt<T, Tag>& other) const {
+    return !(*this == other);
+}
\ No newline at end of file
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <array>
+#include <functional>
 #include <memory>
 
 #include "ListNode.h"
 #include "ListNodeIt.h"
+#include "ListReclaimer.h"
+
+template <typename T>
+class SizeLinkedList;
 
 template <typename T>
 class LinkedList {
@@ -19,6 +25,7 @@ class LinkedList {
     LinkedList(const LinkedList<T>& lst);
     LinkedList(LinkedList<T>&& lst) noexcept;
     LinkedList(std::initializer_list<T> lst);
+    ~LinkedList();
 
     LinkedList<T>& operator=(const LinkedList<T>& lst);
     LinkedList<T>& operator=(LinkedList<T>&& lst);
@@ -27,12 +34,28 @@ class LinkedList {
     void append(const T& key);
     void insert(const T& key, iterator position);
 
-    void erase(iterator position);
-    void erase(iterator start, iterator end);
+    void erase(iterator position);  // O(1)
+    void erase(iterator start, iterator end);  // O(number of erased elements)
+
+    // Relinking operations, which move nodes between or inside lists without allocating or copying keys.
+    // Iterators to moved nodes stay valid and point into the list the nodes are in now
+    void splice(iterator position, LinkedList<T>& other);  // O(1), moves all nodes of other in front of position
+    void splice(iterator position, LinkedList<T>& other, iterator first, iterator last);  // O(1), position may not lie in [first, last)
+    template <class Comp = std::less<T>>
+    void merge(LinkedList<T>& other, Comp comp = Comp());  // O(n + m), both lists have to be sorted, stable
+    template <class Comp = std::less<T>>
+    void sort(Comp comp = Comp());  // O(n log n), stable bottom up merge sort
+
+    // Taking nodes out of a SizeLinkedList would leave its size wrong, so only another SizeLinkedList may do that
+    void splice(iterator position, SizeLinkedList<T>& other) = delete;
+    void splice(iterator position, SizeLinkedList<T>& other, iterator first, iterator last) = delete;
+    template <class Comp = std::less<T>>
+    void merge(SizeLinkedList<T>& other, Comp comp = Comp()) = delete;
 
     int computeSize() const;
     bool isEmpty() const;
-    void clear();
+    void clear();  // O(n)
+    void clear(ListReclaimer& reclaimer);  // O(1), the nodes are freed on the reclaimer's thread
 
     iterator begin();
     iterator end();
@@ -40,6 +63,13 @@ class LinkedList {
     iterator end() const;
     iterator cbegin() const;
     iterator cend() const;
+
+   private:
+    static void freeNodes(std::unique_ptr<ListNode<T>> head);
+
+    template <class Comp>
+    static void mergeChains(std::unique_ptr<ListNode<T>>& into, std::unique_ptr<ListNode<T>>& from, Comp& comp);
+    void restoreLinks();
 };
 
 // Constructors
@@ -62,6 +92,11 @@ LinkedList<T>::LinkedList(std::initializer_list<T> lst) : LinkedList() {
         append(item);
 }
 
+template <typename T>
+LinkedList<T>::~LinkedList() {
+    clear();
+}
+
 // Assignment operators
 
 template <typename T>
@@ -71,14 +106,15 @@ LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& lst) {
     for (const T& item : lst)
         tmp.append(item);
 
-    head_ = std::move(tmp.head_);
-    return *this;
+    return *this = std::move(tmp);
 }
 
 template <typename T>
 LinkedList<T>& LinkedList<T>::operator=(LinkedList<T>&& lst) {
+    clear();
     head_ = std::move(lst.head_);
-    tail_ = std::move(lst.tail_);
+    tail_ = lst.tail_;
+    lst.tail_ = nullptr;
 
     return *this;
 }
@@ -133,55 +169,146 @@ void LinkedList<T>::insert(const T& key, iterator position) {  // O(1)
 // Deletion functions
 
 template <typename T>
-void LinkedList<T>::erase(iterator position) {  // O(1)
+void LinkedList<T>::erase(iterator position) {
     ListNode<T>* toDelete = position.currentNode_;
     if (toDelete == nullptr || head_ == nullptr)
         return;
 
-    if (toDelete == head_.get()) {
-        if (head_->next == nullptr) {
-            head_ = nullptr;
-            tail_ = nullptr;
-        } else {
-            head_ = std::move(head_->next);
-            head_->prev = nullptr;
-        }
-    }
-
     if (toDelete->next != nullptr)
         toDelete->next->prev = toDelete->prev;
+    else
+        tail_ = toDelete->prev;
 
-    if (toDelete->prev != nullptr)
-        toDelete->prev->next = std::move(toDelete->next);
+    // The pointer that owns toDelete takes over its successor, which destroys toDelete
+    std::unique_ptr<ListNode<T>>& owner = toDelete->prev == nullptr ? head_ : toDelete->prev->next;
+    owner = std::move(toDelete->next);
 }
 
 template <typename T>
-void LinkedList<T>::erase(iterator start, iterator end) {  // O(1)
+void LinkedList<T>::erase(iterator start, iterator end) {
     ListNode<T>* startNode = start.currentNode_;
     ListNode<T>* endNode = end.currentNode_;
 
-    if (startNode == nullptr)
+    if (startNode == nullptr || startNode == endNode)
         return;
 
-    if (startNode == head_.get()) {
-        if (endNode == nullptr) {
-            head_ = nullptr;
-            tail_ = nullptr;
-        } else {
-            head_ = std::move(endNode->prev->next);
-            head_->prev = nullptr;
-        }
+    ListNode<T>* prevNode = startNode->prev;
+    std::unique_ptr<ListNode<T>>& owner = prevNode == nullptr ? head_ : prevNode->next;
+    std::unique_ptr<ListNode<T>> erased = std::move(owner);
+
+    if (endNode == nullptr) {
+        tail_ = prevNode;
     } else {
-        ListNode<T>* prevNode = startNode->prev;
-
-        if (endNode == nullptr) {
-            prevNode->next = nullptr;
-            tail_ = prevNode;
-        } else {
-            prevNode->next = std::move(endNode->prev->next);
-            endNode->prev = prevNode;
+        owner = std::move(endNode->prev->next);
+        endNode->prev = prevNode;
+    }
+    freeNodes(std::move(erased));
+}
+
+// Relinking functions
+
+template <typename T>
+void LinkedList<T>::splice(iterator position, LinkedList<T>& other) {
+    if (&other != this)
+        splice(position, other, other.begin(), other.end());
+}
+
+template <typename T>
+void LinkedList<T>::splice(iterator position, LinkedList<T>& other, iterator first, iterator last) {
+    ListNode<T>* firstNode = first.currentNode_;
+    ListNode<T>* lastNode = last.currentNode_;
+    if (firstNode == nullptr || firstNode == lastNode)
+        return;
+
+    // Unlink [first, last) from other
+    ListNode<T>* beforeFirst = firstNode->prev;
+    std::unique_ptr<ListNode<T>>& owner = beforeFirst == nullptr ? other.head_ : beforeFirst->next;
+    std::unique_ptr<ListNode<T>> range = std::move(owner);
+    ListNode<T>* rangeBack;
+    if (lastNode == nullptr) {
+        rangeBack = other.tail_;
+        other.tail_ = beforeFirst;
+    } else {
+        rangeBack = lastNode->prev;
+        owner = std::move(rangeBack->next);
+        lastNode->prev = beforeFirst;
+    }
+
+    // Link it in front of position, which is looked up only now, as it may be in other
+    ListNode<T>* positionNode = position.currentNode_;
+    ListNode<T>* beforePosition = positionNode == nullptr ? tail_ : positionNode->prev;
+    std::unique_ptr<ListNode<T>>& target = beforePosition == nullptr ? head_ : beforePosition->next;
+    if (positionNode == nullptr)
+        tail_ = rangeBack;
+    else
+        positionNode->prev = rangeBack;
+
+    rangeBack->next = std::move(target);
+    range->prev = beforePosition;
+    target = std::move(range);
+}
+
+template <typename T>
+template <class Comp>
+void LinkedList<T>::merge(LinkedList<T>& other, Comp comp) {
+    if (&other == this)
+        return;
+
+    try {
+        mergeChains(head_, other.head_, comp);
+    } catch (...) {
+        restoreLinks();
+        other.restoreLinks();
+        throw;
+    }
+    restoreLinks();
+    other.tail_ = nullptr;
+}
+
+// bins[i] is empty or holds a sorted chain of 2^i nodes, and higher bins hold earlier nodes. Every node is merged
+// into the lowest bins like a carry through a binary counter, which needs no allocation and no knowledge of the size.
+// The prev pointers are ignored while sorting and restored at the end.
+template <typename T>
+template <class Comp>
+void LinkedList<T>::sort(Comp comp) {
+    std::array<std::unique_ptr<ListNode<T>>, 64> bins;
+    std::unique_ptr<ListNode<T>> carry;
+
+    try {
+        while (head_ != nullptr) {
+            carry = std::move(head_);
+            head_ = std::move(carry->next);
+
+            size_t i = 0;
+            for (; bins[i] != nullptr; ++i) {
+                mergeChains(bins[i], carry, comp);
+                carry = std::move(bins[i]);
+            }
+            bins[i] = std::move(carry);
         }
+
+        for (size_t i = 1; i < bins.size(); ++i)
+            mergeChains(bins[i], bins[i - 1], comp);
+        head_ = std::move(bins.back());
+    } catch (...) {
+        // Every node is still owned by head_, carry or a bin, so the list is put back together unsorted
+        auto putBack = [this](std::unique_ptr<ListNode<T>>& chain) {
+            if (chain == nullptr)
+                return;
+
+            ListNode<T>* back = chain.get();
+            while (back->next != nullptr)
+                back = back->next.get();
+            back->next = std::move(head_);
+            head_ = std::move(chain);
+        };
+        putBack(carry);
+        for (std::unique_ptr<ListNode<T>>& bin : bins)
+            putBack(bin);
+        restoreLinks();
+        throw;
     }
+    restoreLinks();
 }
 
 // Utility functions
@@ -202,8 +329,19 @@ bool LinkedList<T>::isEmpty() const {
 
 template <typename T>
 void LinkedList<T>::clear() {
-    head_ = nullptr;
+    freeNodes(std::move(head_));
+    tail_ = nullptr;
+}
+
+template <typename T>
+void LinkedList<T>::clear(ListReclaimer& reclaimer) {
+    if (head_ == nullptr)
+        return;
+
+    // The task owns the nodes from here on, so if handing it over throws, they are freed on this thread instead
     tail_ = nullptr;
+    std::shared_ptr<ListNode<T>> nodes(head_.release(), [](ListNode<T>* head) { freeNodes(std::unique_ptr<ListNode<T>>(head)); });
+    reclaimer.reclaim([nodes = std::move(nodes)]() mutable { nodes.reset(); });
 }
 
 // begin / end functions
@@ -236,4 +374,47 @@ typename LinkedList<T>::iterator LinkedList<T>::cbegin() const {
 template <typename T>
 typename LinkedList<T>::iterator LinkedList<T>::cend() const {
     return iterator(nullptr);
+}
+
+// private utility
+
+// Destroying the head would destroy its successor from inside its destructor and so on, which recurses once per node.
+// Taking over the successor before the head is destroyed frees the nodes one after another instead.
+template <typename T>
+void LinkedList<T>::freeNodes(std::unique_ptr<ListNode<T>> head) {
+    while (head != nullptr)
+        head = std::move(head->next);
+}
+
+// Moves the nodes of the sorted chain from into the sorted chain into, nodes of into come first among equal keys.
+// Every node is owned by into or from whenever comp is called, so an exception loses no nodes
+template <typename T>
+template <class Comp>
+void LinkedList<T>::mergeChains(std::unique_ptr<ListNode<T>>& into, std::unique_ptr<ListNode<T>>& from, Comp& comp) {
+    std::unique_ptr<ListNode<T>>* position = &into;
+    while (from != nullptr) {
+        while (*position != nullptr && !comp(from->key, (*position)->key))
+            position = &(*position)->next;
+
+        if (*position == nullptr) {
+            *position = std::move(from);
+            return;
+        }
+
+        std::unique_ptr<ListNode<T>> node = std::move(from);
+        from = std::move(node->next);
+        node->next = std::move(*position);
+        *position = std::move(node);
+        position = &(*position)->next;
+    }
+}
+
+template <typename T>
+void LinkedList<T>::restoreLinks() {  // Sets the prev pointers and tail_ from the next pointers
+    ListNode<T>* prev = nullptr;
+    for (ListNode<T>* node = head_.get(); node != nullptr; node = node->next.get()) {
+        node->prev = prev;
+        prev = node;
+    }
+    tail_ = prev;
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdexcept>
+
 #include "ListNode.h"
 
 template <typename T>
@@ -0,0 +1,48 @@
+#include "ListReclaimer.h"
+
+ListReclaimer::ListReclaimer() : busy_(false), stopping_(false), thread_(&ListReclaimer::run, this) {}
+
+ListReclaimer::~ListReclaimer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+}
+
+void ListReclaimer::reclaim(std::function<void()> freeLoop) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(freeLoop));
+    }
+    condition_.notify_all();
+}
+
+void ListReclaimer::waitUntilIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]() { return pending_.empty() && !busy_; });
+}
+
+// Takes all pending work at once and runs it without holding the lock
+void ListReclaimer::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        condition_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+        if (pending_.empty())
+            return;
+
+        std::vector<std::function<void()>> work;
+        work.swap(pending_);
+        busy_ = true;
+        lock.unlock();
+
+        for (auto& freeLoop : work)
+            freeLoop();
+        work.clear();
+
+        lock.lock();
+        busy_ = false;
+        condition_.notify_all();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs the free loops of detached lists on a background thread, so clearing a long list returns in O(1).
+// The keys are destroyed on that thread. Pending work is finished before the reclaimer is destroyed.
+class ListReclaimer {
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<std::function<void()>> pending_;
+    bool busy_;
+    bool stopping_;
+    std::thread thread_;
+
+   public:
+    ListReclaimer();
+    ~ListReclaimer();
+
+    ListReclaimer(const ListReclaimer&) = delete;
+    ListReclaimer& operator=(const ListReclaimer&) = delete;
+
+    void reclaim(std::function<void()> freeLoop);  // O(1)
+    void waitUntilIdle();  // Blocks until everything handed over so far is freed
+
+   private:
+    void run();
+};
\ No newline at end of file
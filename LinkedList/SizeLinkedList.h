@@ -30,7 +30,14 @@ class SizeLinkedList : public LinkedList<T> {
     void erase(iterator position);
     void erase(iterator start, iterator end);
 
+    // The sizes are carried over, only splicing a range between two lists has to count it
+    void splice(iterator position, SizeLinkedList<T>& other);  // O(1)
+    void splice(iterator position, SizeLinkedList<T>& other, iterator first, iterator last);  // O(1) inside one list, O(last - first) otherwise
+    template <class Comp = std::less<T>>
+    void merge(SizeLinkedList<T>& other, Comp comp = Comp());
+
     void clear();
+    void clear(ListReclaimer& reclaimer);
 
     size_t size() const;
 
@@ -111,13 +118,54 @@ void SizeLinkedList<T>::erase(iterator position) {
 
 template <typename T>
 void SizeLinkedList<T>::erase(iterator start, iterator end) {
-    iterator it = start;
-    iterator itPrev;
-    while (it != end + 1) {
-        itPrev = it;
-        ++it;
-        erase(itPrev);
+    size_t count = 0;
+    for (iterator it = start; it != end; ++it)
+        ++count;
+
+    LinkedList<T>::erase(start, end);
+    size_ -= count;
+}
+
+// Relinking functions
+
+template <typename T>
+void SizeLinkedList<T>::splice(iterator position, SizeLinkedList<T>& other) {
+    if (&other == this)
+        return;
+
+    LinkedList<T>::splice(position, static_cast<LinkedList<T>&>(other));
+    size_ += other.size_;
+    other.size_ = 0;
+}
+
+template <typename T>
+void SizeLinkedList<T>::splice(iterator position, SizeLinkedList<T>& other, iterator first, iterator last) {
+    size_t count = 0;
+    if (&other != this) {
+        for (iterator it = first; it != last; ++it)
+            ++count;
     }
+
+    LinkedList<T>::splice(position, static_cast<LinkedList<T>&>(other), first, last);
+    size_ += count;
+    other.size_ -= count;
+}
+
+template <typename T>
+template <class Comp>
+void SizeLinkedList<T>::merge(SizeLinkedList<T>& other, Comp comp) {
+    if (&other == this)
+        return;
+
+    try {
+        LinkedList<T>::merge(static_cast<LinkedList<T>&>(other), comp);
+    } catch (...) {  // Some nodes may have moved already
+        size_ = computeSize();
+        other.size_ = other.computeSize();
+        throw;
+    }
+    size_ += other.size_;
+    other.size_ = 0;
 }
 
 template <typename T>
@@ -126,6 +174,12 @@ void SizeLinkedList<T>::clear() {
     size_ = 0;
 }
 
+template <typename T>
+void SizeLinkedList<T>::clear(ListReclaimer& reclaimer) {
+    LinkedList<T>::clear(reclaimer);
+    size_ = 0;
+}
+
 template <typename T>
 size_t SizeLinkedList<T>::size() const {
     return size_;
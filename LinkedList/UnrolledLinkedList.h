@@ -0,0 +1,298 @@
+#pragma once
+
+#include <memory>
+
+#include "UnrolledListNode.h"
+#include "UnrolledListNodeIt.h"
+
+// LinkedList that stores up to Capacity keys per node, which saves the pointers of a node per key and lets iteration
+// walk through contiguous memory. Full nodes are split when inserting and nodes that drop below half full are merged
+// with or refilled from a neighbour, so every node except the last one is at least half full.
+// Insertions and deletions invalidate all iterators.
+template <typename T, size_t Capacity = defaultUnrolledCapacity<T>()>
+class UnrolledLinkedList {
+    static_assert(Capacity >= 2, "Nodes of an unrolled list need room for at least two keys");
+
+    using Node = UnrolledListNode<T, Capacity>;
+
+    std::unique_ptr<Node> head_;
+    Node* tail_;
+
+   public:
+    using iterator = UnrolledListNodeIt<T, Capacity>;
+
+    UnrolledLinkedList() : head_(nullptr), tail_(nullptr) {}
+    UnrolledLinkedList(const UnrolledLinkedList<T, Capacity>& lst);
+    UnrolledLinkedList(UnrolledLinkedList<T, Capacity>&& lst) noexcept;
+    UnrolledLinkedList(std::initializer_list<T> lst);
+    ~UnrolledLinkedList();
+
+    UnrolledLinkedList<T, Capacity>& operator=(const UnrolledLinkedList<T, Capacity>& lst);
+    UnrolledLinkedList<T, Capacity>& operator=(UnrolledLinkedList<T, Capacity>&& lst);
+    UnrolledLinkedList<T, Capacity>& operator=(std::initializer_list<T> lst);
+
+    void append(const T& key);  // O(1)
+    void insert(const T& key, iterator position);  // O(Capacity)
+
+    void erase(iterator position);  // O(Capacity)
+    void erase(iterator start, iterator end);  // O(Capacity + number of nodes in the range)
+
+    int computeSize() const;  // O(n / Capacity)
+    bool isEmpty() const;
+    void clear();
+
+    iterator begin();
+    iterator end();
+    iterator begin() const;
+    iterator end() const;
+    iterator cbegin() const;
+    iterator cend() const;
+
+   private:
+    static constexpr size_t minimumCount = Capacity / 2;
+
+    Node* insertNodeAfter(Node* node);  // Inserts an empty node, nullptr inserts it into an empty list
+    void removeNode(Node* node);
+    void rebalance(Node* node);
+};
+
+// Constructors
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>::UnrolledLinkedList(const UnrolledLinkedList<T, Capacity>& lst) : UnrolledLinkedList() {
+    for (const T& item : lst)
+        append(item);
+}
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>::UnrolledLinkedList(UnrolledLinkedList<T, Capacity>&& lst) noexcept : head_(std::move(lst.head_)), tail_(lst.tail_) {
+    lst.tail_ = nullptr;
+}
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>::UnrolledLinkedList(std::initializer_list<T> lst) : UnrolledLinkedList() {
+    for (const T& item : lst)
+        append(item);
+}
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>::~UnrolledLinkedList() {
+    clear();
+}
+
+// Assignment operators
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>& UnrolledLinkedList<T, Capacity>::operator=(const UnrolledLinkedList<T, Capacity>& lst) {
+    UnrolledLinkedList<T, Capacity> tmp(lst);
+    return *this = std::move(tmp);
+}
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>& UnrolledLinkedList<T, Capacity>::operator=(UnrolledLinkedList<T, Capacity>&& lst) {
+    clear();
+    head_ = std::move(lst.head_);
+    tail_ = lst.tail_;
+    lst.tail_ = nullptr;
+
+    return *this;
+}
+
+template <typename T, size_t Capacity>
+UnrolledLinkedList<T, Capacity>& UnrolledLinkedList<T, Capacity>::operator=(std::initializer_list<T> lst) {
+    clear();
+
+    for (const T& item : lst)
+        append(item);
+
+    return *this;
+}
+
+// Insertion functions
+
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::append(const T& key) {
+    if (tail_ == nullptr || tail_->isFull())
+        insertNodeAfter(tail_);
+    tail_->insert(tail_->count, key);
+}
+
+// A full node is split in half first, and key goes into the half that holds position
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::insert(const T& key, iterator position) {
+    Node* node = position.currentNode_;
+    if (node == nullptr) {
+        append(key);
+        return;
+    }
+
+    size_t index = position.index_;
+    if (node->isFull()) {
+        Node* right = insertNodeAfter(node);
+        node->transfer(Capacity / 2, Capacity, *right, 0);
+        if (index > node->count) {
+            index -= node->count;
+            node = right;
+        }
+    }
+    node->insert(index, key);
+}
+
+// Deletion functions
+
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::erase(iterator position) {
+    Node* node = position.currentNode_;
+    if (node == nullptr)
+        return;
+
+    node->erase(position.index_, position.index_ + 1);
+    rebalance(node);
+}
+
+// Whole nodes inside the range are unlinked without looking at their keys
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::erase(iterator start, iterator end) {
+    Node* first = start.currentNode_;
+    Node* last = end.currentNode_;
+    if (first == nullptr || start == end)
+        return;
+
+    if (first == last) {
+        first->erase(start.index_, end.index_);
+        rebalance(first);
+        return;
+    }
+
+    first->erase(start.index_, first->count);
+    while (first->next.get() != last)
+        removeNode(first->next.get());
+
+    // Rebalancing last can only merge it into first, never remove first
+    if (last != nullptr) {
+        last->erase(0, end.index_);
+        rebalance(last);
+    }
+    rebalance(first);
+}
+
+// Utility functions
+
+template <typename T, size_t Capacity>
+int UnrolledLinkedList<T, Capacity>::computeSize() const {
+    int result = 0;
+    for (const Node* node = head_.get(); node != nullptr; node = node->next.get())
+        result += node->count;
+
+    return result;
+}
+
+template <typename T, size_t Capacity>
+bool UnrolledLinkedList<T, Capacity>::isEmpty() const {
+    return head_ == nullptr;
+}
+
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::clear() {  // Unlinks the nodes one by one, so long lists do not recurse
+    while (head_ != nullptr)
+        head_ = std::move(head_->next);
+    tail_ = nullptr;
+}
+
+// begin / end functions
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::iterator UnrolledLinkedList<T, Capacity>::begin() {
+    return iterator(head_.get());
+}
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::iterator UnrolledLinkedList<T, Capacity>::end() {
+    return iterator(nullptr);
+}
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::iterator UnrolledLinkedList<T, Capacity>::begin() const {
+    return cbegin();
+}
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::iterator UnrolledLinkedList<T, Capacity>::end() const {
+    return cend();
+}
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::iterator UnrolledLinkedList<T, Capacity>::cbegin() const {
+    return iterator(head_.get());
+}
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::iterator UnrolledLinkedList<T, Capacity>::cend() const {
+    return iterator(nullptr);
+}
+
+// private utility
+
+template <typename T, size_t Capacity>
+typename UnrolledLinkedList<T, Capacity>::Node* UnrolledLinkedList<T, Capacity>::insertNodeAfter(Node* node) {
+    std::unique_ptr<Node> newNode = std::make_unique<Node>();
+    Node* result = newNode.get();
+    if (node == nullptr) {
+        head_ = std::move(newNode);
+        tail_ = result;
+        return result;
+    }
+
+    newNode->next = std::move(node->next);
+    if (newNode->next != nullptr)
+        newNode->next->prev = result;
+    else
+        tail_ = result;
+
+    newNode->prev = node;
+    node->next = std::move(newNode);
+    return result;
+}
+
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::removeNode(Node* node) {
+    if (node->next != nullptr)
+        node->next->prev = node->prev;
+    else
+        tail_ = node->prev;
+
+    if (node->prev != nullptr)
+        node->prev->next = std::move(node->next);  // Destroys node
+    else
+        head_ = std::move(node->next);
+}
+
+// Merges a node that is less than half full with a neighbour if both fit into one node,
+// otherwise moves keys from the neighbour, so both end up at least half full
+template <typename T, size_t Capacity>
+void UnrolledLinkedList<T, Capacity>::rebalance(Node* node) {
+    if (node->count == 0) {
+        removeNode(node);
+        return;
+    }
+    if (node->count >= minimumCount)
+        return;
+
+    Node* left = node;
+    Node* right = node->next.get();
+    if (right == nullptr) {
+        right = node;
+        left = node->prev;
+        if (left == nullptr)
+            return;
+    }
+
+    if (left->count + right->count <= Capacity) {
+        right->transfer(0, right->count, *left, left->count);
+        removeNode(right);
+    } else if (left->count < right->count) {
+        right->transfer(0, (right->count - left->count) / 2, *left, left->count);
+    } else {
+        left->transfer(left->count - (left->count - right->count) / 2, left->count, *right, 0);
+    }
+}
\ No newline at end of file
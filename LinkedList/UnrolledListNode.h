@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Default number of keys per node, so that the keys of a node fill about four cache lines
+template <typename T>
+constexpr size_t defaultUnrolledCapacity() {
+    return 256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4;
+}
+
+// Node that stores up to Capacity keys next to each other. The keys [0, count) are constructed, the rest of the
+// storage is raw memory, so keys are relocated (moved and then destroyed) when they are shifted inside or between nodes
+template <typename T, size_t Capacity>
+class UnrolledListNode {
+    alignas(T) unsigned char storage_[sizeof(T) * Capacity];
+
+   public:
+    std::unique_ptr<UnrolledListNode<T, Capacity>> next;
+    UnrolledListNode<T, Capacity>* prev;
+    size_t count;
+
+    UnrolledListNode() : next(nullptr), prev(nullptr), count(0) {}
+    ~UnrolledListNode();
+
+    UnrolledListNode(const UnrolledListNode<T, Capacity>&) = delete;
+    UnrolledListNode<T, Capacity>& operator=(const UnrolledListNode<T, Capacity>&) = delete;
+
+    T& key(size_t index);
+    const T& key(size_t index) const;
+
+    bool isFull() const;
+
+    void insert(size_t index, const T& key);  // O(Capacity)
+    void erase(size_t first, size_t last);  // O(Capacity)
+
+    // Moves the keys [first, last) in front of index position of target
+    void transfer(size_t first, size_t last, UnrolledListNode<T, Capacity>& target, size_t position);
+
+   private:
+    T* slot(size_t index);
+
+    void shiftRight(size_t first, size_t distance);  // Relocates [first, count) by distance, count is not changed
+    void shiftLeft(size_t first, size_t distance);
+};
+
+// Constructors
+
+template <typename T, size_t Capacity>
+UnrolledListNode<T, Capacity>::~UnrolledListNode() {
+    for (size_t i = 0; i < count; ++i)
+        key(i).~T();
+}
+
+// Access functions
+
+template <typename T, size_t Capacity>
+T& UnrolledListNode<T, Capacity>::key(size_t index) {
+    return *slot(index);
+}
+
+template <typename T, size_t Capacity>
+const T& UnrolledListNode<T, Capacity>::key(size_t index) const {
+    return *std::launder(reinterpret_cast<const T*>(storage_ + index * sizeof(T)));
+}
+
+template <typename T, size_t Capacity>
+bool UnrolledListNode<T, Capacity>::isFull() const {
+    return count == Capacity;
+}
+
+// Insertion and deletion functions
+
+template <typename T, size_t Capacity>
+void UnrolledListNode<T, Capacity>::insert(size_t index, const T& key) {
+    shiftRight(index, 1);
+    new (storage_ + index * sizeof(T)) T(key);
+    ++count;
+}
+
+template <typename T, size_t Capacity>
+void UnrolledListNode<T, Capacity>::erase(size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i)
+        key(i).~T();
+
+    shiftLeft(last, last - first);
+    count -= last - first;
+}
+
+template <typename T, size_t Capacity>
+void UnrolledListNode<T, Capacity>::transfer(size_t first, size_t last, UnrolledListNode<T, Capacity>& target, size_t position) {
+    size_t distance = last - first;
+    target.shiftRight(position, distance);
+    for (size_t i = 0; i < distance; ++i) {
+        new (target.storage_ + (position + i) * sizeof(T)) T(std::move(key(first + i)));
+        key(first + i).~T();
+    }
+    target.count += distance;
+
+    shiftLeft(last, distance);
+    count -= distance;
+}
+
+// private utility
+
+template <typename T, size_t Capacity>
+T* UnrolledListNode<T, Capacity>::slot(size_t index) {
+    return std::launder(reinterpret_cast<T*>(storage_ + index * sizeof(T)));
+}
+
+// Going from the back, every target slot is either behind count or was already relocated, so it holds no key
+template <typename T, size_t Capacity>
+void UnrolledListNode<T, Capacity>::shiftRight(size_t first, size_t distance) {
+    for (size_t i = count; i > first; --i) {
+        new (storage_ + (i - 1 + distance) * sizeof(T)) T(std::move(key(i - 1)));
+        key(i - 1).~T();
+    }
+}
+
+template <typename T, size_t Capacity>
+void UnrolledListNode<T, Capacity>::shiftLeft(size_t first, size_t distance) {
+    for (size_t i = first; i < count; ++i) {
+        new (storage_ + (i - distance) * sizeof(T)) T(std::move(key(i)));
+        key(i).~T();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+#include "UnrolledListNode.h"
+
+template <typename T, size_t Capacity>
+class UnrolledLinkedList;
+
+// Iterator that holds a node and the index of a key in it. Moving inside a node only changes the index,
+// so iterating touches one node per Capacity keys
+template <typename T, size_t Capacity>
+class UnrolledListNodeIt {
+    UnrolledListNode<T, Capacity>* currentNode_;
+    size_t index_;
+
+    friend class UnrolledLinkedList<T, Capacity>;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    UnrolledListNodeIt() : currentNode_(nullptr), index_(0) {}
+    UnrolledListNodeIt(UnrolledListNode<T, Capacity>* node, size_t index = 0) : currentNode_(node), index_(index) {}
+
+    UnrolledListNodeIt<T, Capacity>& operator++();
+    UnrolledListNodeIt<T, Capacity>& operator--();
+
+    UnrolledListNodeIt<T, Capacity> next() const;
+    UnrolledListNodeIt<T, Capacity> prev() const;
+
+    bool isValid() const;
+
+    T& operator*();
+    const T& operator*() const;
+
+    bool operator==(const UnrolledListNodeIt<T, Capacity>& other) const;
+    bool operator!=(const UnrolledListNodeIt<T, Capacity>& other) const;
+};
+
+// Increment / Decrement operators
+
+template <typename T, size_t Capacity>
+UnrolledListNodeIt<T, Capacity>& UnrolledListNodeIt<T, Capacity>::operator++() {
+    if (currentNode_ == nullptr)
+        throw std::runtime_error("Tried to increment invalid iterator");
+
+    if (++index_ == currentNode_->count) {
+        currentNode_ = currentNode_->next.get();
+        index_ = 0;
+    }
+    return *this;
+}
+
+template <typename T, size_t Capacity>
+UnrolledListNodeIt<T, Capacity>& UnrolledListNodeIt<T, Capacity>::operator--() {
+    if (currentNode_ == nullptr)
+        throw std::runtime_error("Tried to decrement invalid iterator");
+
+    if (index_ > 0) {
+        --index_;
+    } else {
+        currentNode_ = currentNode_->prev;
+        index_ = currentNode_ == nullptr ? 0 : currentNode_->count - 1;
+    }
+    return *this;
+}
+
+template <typename T, size_t Capacity>
+UnrolledListNodeIt<T, Capacity> UnrolledListNodeIt<T, Capacity>::next() const {
+    UnrolledListNodeIt<T, Capacity> result = *this;
+    return ++result;
+}
+
+template <typename T, size_t Capacity>
+UnrolledListNodeIt<T, Capacity> UnrolledListNodeIt<T, Capacity>::prev() const {
+    UnrolledListNodeIt<T, Capacity> result = *this;
+    return --result;
+}
+
+template <typename T, size_t Capacity>
+bool UnrolledListNodeIt<T, Capacity>::isValid() const {
+    return currentNode_ != nullptr;
+}
+
+// Dereference operators
+
+template <typename T, size_t Capacity>
+T& UnrolledListNodeIt<T, Capacity>::operator*() {
+    return currentNode_->key(index_);
+}
+
+template <typename T, size_t Capacity>
+const T& UnrolledListNodeIt<T, Capacity>::operator*() const {
+    return currentNode_->key(index_);
+}
+
+// Comparision operators
+
+template <typename T, size_t Capacity>
+bool UnrolledListNodeIt<T, Capacity>::operator==(const UnrolledListNodeIt<T, Capacity>& other) const {
+    return currentNode_ == other.currentNode_ && index_ == other.index_;
+}
+
+template <typename T, size_t Capacity>
+bool UnrolledListNodeIt<T, Capacity>::operator!=(const UnrolledListNodeIt<T, Capacity>& other) const {
+    return !(*this == other);
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Number of threads an operation with a threadCount parameter uses, where 0 means one thread per core
+inline size_t resolveThreadCount(size_t threadCount) {
+    if (threadCount == 0)
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    return threadCount;
+}
+
+// Runs task(i) for every i < taskCount. The calling thread and threadCount - 1 helper threads (0 means one per core)
+// take the next task whenever they are done with one, so threads that get small tasks simply do more of them.
+// The first exception thrown by a task is rethrown after all threads are done.
+template <class Task>
+void runParallel(size_t taskCount, size_t threadCount, Task& task) {
+    threadCount = std::min(resolveThreadCount(threadCount), taskCount);
+
+    std::atomic<size_t> nextTask(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        try {
+            for (size_t i = nextTask++; i < taskCount; i = nextTask++)
+                task(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (error == nullptr)
+                error = std::current_exception();
+            nextTask = taskCount;  // Let the other threads stop
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (size_t i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    if (error != nullptr)
+        std::rethrow_exception(error);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+// Measures the time since it was created
+class Stopwatch {
+    std::chrono::steady_clock::time_point start_;
+
+   public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+};
+
+// Calls run() repeats times and returns the fastest result. run() starts a Stopwatch after its setup and returns its seconds,
+// so only the measured part counts and a single disturbed run does not decide the result.
+template <class Run>
+double bestOf(int repeats, Run run) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repeats; ++i)
+        best = std::min(best, run());
+    return best;
+}
+
+// The checksum depends on the results, so the compiler cannot drop the measured work
+inline void report(const std::string& name, double seconds, unsigned long long checksum) {
+    std::printf("%-40s %8.3fs   checksum %llu\n", name.c_str(), seconds, checksum);
+}
+
+// Returns the index-th command line argument as a number, or fallback if there is none
+inline size_t argument(int argc, char** argv, int index, size_t fallback) {
+    return index < argc ? std::strtoull(argv[index], nullptr, 10) : fallback;
+}
\ No newline at end of file
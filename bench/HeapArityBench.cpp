@@ -0,0 +1,42 @@
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/Heap.h"
+
+// Inserts all keys and extracts them again, once for each arity with and without cache line aligned child groups.
+// Usage: HeapArityBench [keys = 4000000]
+template <class HeapType>
+static void run(const std::string& name, const std::vector<int>& keys) {
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        HeapType heap;
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (int key : keys)
+            heap.insert(key);
+        while (!heap.isEmpty())
+            checksum = checksum * 31 + heap.extractExtremum();
+        return stopwatch.seconds();
+    });
+    report(name, seconds, checksum);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argument(argc, argv, 1, 4000000);
+    std::default_random_engine engine(34);
+    std::uniform_int_distribution<int> dist;
+    std::vector<int> keys(count);
+    for (int& key : keys)
+        key = dist(engine);
+
+    run<Heap<int>>("binary", keys);
+    run<Heap<int, std::less<int>, std::vector<int>, 4>>("4-ary", keys);
+    run<DaryHeap<int, 4>>("4-ary, aligned children", keys);
+    run<Heap<int, std::less<int>, std::vector<int>, 8>>("8-ary", keys);
+    run<DaryHeap<int, 8>>("8-ary, aligned children", keys);
+    run<Heap<int, std::less<int>, std::vector<int>, 16>>("16-ary", keys);
+    run<DaryHeap<int, 16>>("16-ary, aligned children", keys);
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/Heap.h"
+
+// Moves long std::string keys through Heap and std::priority_queue, then keeps the largest keys of an ascending stream,
+// where every key replaces the extremum, once with replaceExtremum and once with a separate extraction and insertion.
+// Usage: HeapMoveBench [keys = 1000000]
+static const size_t keyLength = 50;
+static const size_t kept = 1000;
+
+static unsigned long long hash(const std::string& key) {
+    return std::hash<std::string>()(key);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argument(argc, argv, 1, 1000000);
+    std::default_random_engine engine(36);
+    std::uniform_int_distribution<int> dist('a', 'z');
+    std::vector<std::string> keys(count, std::string(keyLength, ' '));
+    for (std::string& key : keys)
+        for (char& c : key)
+            c = static_cast<char>(dist(engine));
+
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        std::vector<std::string> input = keys;
+        Heap<std::string> heap;
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (std::string& key : input)
+            heap.insert(std::move(key));
+        while (!heap.isEmpty())
+            checksum = checksum * 31 + hash(heap.extractExtremum());
+        return stopwatch.seconds();
+    });
+    report("Heap insert / extractExtremum", seconds, checksum);
+
+    seconds = bestOf(3, [&]() {
+        std::vector<std::string> input = keys;
+        std::priority_queue<std::string, std::vector<std::string>, std::greater<std::string>> queue;
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (std::string& key : input)
+            queue.push(std::move(key));
+        while (!queue.empty()) {
+            checksum = checksum * 31 + hash(queue.top());
+            queue.pop();
+        }
+        return stopwatch.seconds();
+    });
+    report("std::priority_queue push / pop", seconds, checksum);
+
+    std::vector<std::string> ascending = keys;
+    std::sort(ascending.begin(), ascending.end());
+
+    seconds = bestOf(3, [&]() {
+        Heap<std::string> heap;
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (const std::string& key : ascending) {
+            if (heap.size() < kept)
+                heap.insert(key);
+            else if (heap.extremum() < key)
+                heap.replaceExtremum(key);
+        }
+        while (!heap.isEmpty())
+            checksum = checksum * 31 + hash(heap.extractExtremum());
+        return stopwatch.seconds();
+    });
+    report("top 1000 with replaceExtremum", seconds, checksum);
+
+    seconds = bestOf(3, [&]() {
+        Heap<std::string> heap;
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (const std::string& key : ascending) {
+            if (heap.size() < kept) {
+                heap.insert(key);
+            } else if (heap.extremum() < key) {
+                heap.extractExtremum();
+                heap.insert(key);
+            }
+        }
+        while (!heap.isEmpty())
+            checksum = checksum * 31 + hash(heap.extractExtremum());
+        return stopwatch.seconds();
+    });
+    report("top 1000 with extract and insert", seconds, checksum);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/KWayMerger.h"
+
+// Merges sorted runs of random ints with KWayMerger and compares that with sorting their concatenation.
+// Usage: KWayMergerBench [runs = 1000] [run length = 20000]
+static unsigned long long checksumOf(const std::vector<int>& values) {
+    unsigned long long checksum = 0;
+    for (int value : values)
+        checksum = checksum * 31 + static_cast<unsigned>(value);
+    return checksum;
+}
+
+int main(int argc, char** argv) {
+    size_t runCount = argument(argc, argv, 1, 1000);
+    size_t runLength = argument(argc, argv, 2, 20000);
+    std::default_random_engine engine(46);
+    std::uniform_int_distribution<int> dist;
+    std::vector<std::vector<int>> runs(runCount, std::vector<int>(runLength));
+    for (std::vector<int>& run : runs) {
+        for (int& value : run)
+            value = dist(engine);
+        std::sort(run.begin(), run.end());
+    }
+
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        std::vector<int> result;
+        result.reserve(runCount * runLength);
+        Stopwatch stopwatch;
+        KWayMerger<std::vector<int>::const_iterator> merger;
+        for (const std::vector<int>& run : runs)
+            merger.addSource(run.begin(), run.end());
+        merger.mergeInto(std::back_inserter(result));
+        double elapsed = stopwatch.seconds();
+        checksum = checksumOf(result);
+        return elapsed;
+    });
+    report("KWayMerger::mergeInto", seconds, checksum);
+
+    seconds = bestOf(3, [&]() {
+        std::vector<int> result;
+        result.reserve(runCount * runLength);
+        Stopwatch stopwatch;
+        for (const std::vector<int>& run : runs)
+            result.insert(result.end(), run.begin(), run.end());
+        std::sort(result.begin(), result.end());
+        double elapsed = stopwatch.seconds();
+        checksum = checksumOf(result);
+        return elapsed;
+    });
+    report("std::sort of the concatenation", seconds, checksum);
+}
\ No newline at end of file
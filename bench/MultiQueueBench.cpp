@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/Heap.h"
+#include "Heap/MultiQueue.h"
+
+// Every thread alternates between inserting a random key and extracting one, on a MultiQueue and on a single Heap
+// behind one mutex. Each thread does the same number of operations, so perfect scaling keeps the time constant.
+// Usage: MultiQueueBench [maximum threads = hardware concurrency] [operations per thread = 1000000]
+static const size_t prefill = 1000000;
+
+// The baseline a MultiQueue has to beat
+class LockedHeap {
+    std::mutex mutex_;
+    Heap<unsigned> heap_;
+
+   public:
+    void insert(unsigned key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        heap_.insert(key);
+    }
+
+    bool tryExtractExtremum(unsigned& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (heap_.isEmpty())
+            return false;
+        key = heap_.extractExtremum();
+        return true;
+    }
+};
+
+template <class Queue>
+static double run(Queue& queue, size_t threadCount, size_t operations, unsigned long long& checksum) {
+    std::default_random_engine engine(38);
+    std::uniform_int_distribution<unsigned> dist;
+    for (size_t i = 0; i < prefill; ++i)
+        queue.insert(dist(engine));
+
+    std::atomic<unsigned long long> sum(0);
+    std::vector<std::thread> threads;
+    Stopwatch stopwatch;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&queue, &sum, operations, t]() {
+            std::default_random_engine threadEngine(static_cast<unsigned>(t));
+            std::uniform_int_distribution<unsigned> threadDist;
+            unsigned long long local = 0;
+            unsigned key;
+            for (size_t i = 0; i < operations; i += 2) {
+                queue.insert(threadDist(threadEngine));
+                if (queue.tryExtractExtremum(key))
+                    local += key;
+            }
+            sum += local;
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    double seconds = stopwatch.seconds();
+    checksum = sum;
+    return seconds;
+}
+
+int main(int argc, char** argv) {
+    size_t maxThreads = argument(argc, argv, 1, std::max(1u, std::thread::hardware_concurrency()));
+    size_t operations = argument(argc, argv, 2, 1000000);
+
+    for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        unsigned long long checksum = 0;
+        double seconds = bestOf(3, [&]() {
+            MultiQueue<unsigned> queue(threadCount);
+            return run(queue, threadCount, operations, checksum);
+        });
+        report("MultiQueue, " + std::to_string(threadCount) + " threads", seconds, checksum);
+
+        seconds = bestOf(3, [&]() {
+            LockedHeap queue;
+            return run(queue, threadCount, operations, checksum);
+        });
+        report("Heap with one mutex, " + std::to_string(threadCount) + " threads", seconds, checksum);
+    }
+}
\ No newline at end of file
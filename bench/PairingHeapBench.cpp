@@ -0,0 +1,91 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/AddressableHeap.h"
+#include "Heap/Heap.h"
+#include "Heap/PairingHeap.h"
+
+// Melds many small heaps into one, then runs a decreaseKey heavy workload like Dijkstra or Prim's on
+// PairingHeap and on the array based AddressableHeap.
+// Usage: PairingHeapBench [keys = 1000000]
+static const size_t heapCount = 2000;
+static const size_t heapSize = 500;
+static const size_t decreasesPerKey = 4;
+
+static void meld(PairingHeap<long long>& heap, PairingHeap<long long>&& other) {
+    heap.meld(std::move(other));
+}
+
+static void meld(Heap<long long>& heap, Heap<long long>&& other) {
+    heap.merge(std::move(other));
+}
+
+template <class HeapType>
+static void runMeld(const std::string& name, const std::vector<long long>& keys) {
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        std::vector<HeapType> heaps(heapCount);
+        for (size_t i = 0; i < heapCount * heapSize; ++i)
+            heaps[i % heapCount].insert(keys[i % keys.size()]);
+        checksum = 0;
+        Stopwatch stopwatch;
+        HeapType result;
+        for (HeapType& heap : heaps)
+            meld(result, std::move(heap));
+        for (size_t i = 0; i < heapSize; ++i)
+            checksum = checksum * 31 + static_cast<unsigned long long>(result.extractExtremum());
+        return stopwatch.seconds();
+    });
+    report(name, seconds, checksum);
+}
+
+// The decreases are drawn up front, so both heaps get the same sequence
+template <class HeapType>
+static void runDecreaseKey(const std::string& name, const std::vector<long long>& keys,
+                           const std::vector<size_t>& targets, const std::vector<long long>& amounts) {
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        HeapType heap;
+        std::vector<typename HeapType::handle> handles;
+        std::vector<long long> current = keys;
+        handles.reserve(keys.size());
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (long long key : keys)
+            handles.push_back(heap.insert(key));
+        for (size_t i = 0; i < targets.size(); ++i) {
+            current[targets[i]] -= amounts[i];
+            heap.decreaseKey(handles[targets[i]], current[targets[i]]);
+        }
+        while (!heap.isEmpty())
+            checksum = checksum * 31 + static_cast<unsigned long long>(heap.extractExtremum());
+        return stopwatch.seconds();
+    });
+    report(name, seconds, checksum);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argument(argc, argv, 1, 1000000);
+    std::default_random_engine engine(39);
+    std::uniform_int_distribution<long long> keyDist(0, 1000000000);
+    std::vector<long long> keys(count);
+    for (long long& key : keys)
+        key = keyDist(engine);
+
+    runMeld<PairingHeap<long long>>("meld 2000 heaps, PairingHeap::meld", keys);
+    runMeld<Heap<long long>>("meld 2000 heaps, Heap::merge", keys);
+
+    std::uniform_int_distribution<size_t> targetDist(0, count - 1);
+    std::uniform_int_distribution<long long> amountDist(1, 1000000);
+    std::vector<size_t> targets(count * decreasesPerKey);
+    std::vector<long long> amounts(targets.size());
+    for (size_t i = 0; i < targets.size(); ++i) {
+        targets[i] = targetDist(engine);
+        amounts[i] = amountDist(engine);
+    }
+
+    runDecreaseKey<PairingHeap<long long>>("decreaseKey, PairingHeap", keys, targets, amounts);
+    runDecreaseKey<AddressableHeap<long long>>("decreaseKey, AddressableHeap", keys, targets, amounts);
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/Heap.h"
+#include "Heap/RadixHeap.h"
+
+// Dijkstra from one corner of a side x side grid with random edge weights, once with RadixHeap and once with Heap.
+// Both skip queue entries whose distance is outdated instead of decreasing keys.
+// Usage: RadixHeapBench [side = 1000]
+static const uint32_t infinity = std::numeric_limits<uint32_t>::max();
+
+struct Grid {
+    uint32_t side;
+    std::vector<uint32_t> right;  // Weight of the edge to the right neighbour
+    std::vector<uint32_t> down;  // Weight of the edge to the neighbour below
+
+    template <class Visit>
+    void forEachNeighbour(uint32_t vertex, Visit visit) const {
+        uint32_t row = vertex / side, column = vertex % side;
+        if (column + 1 < side)
+            visit(vertex + 1, right[vertex]);
+        if (column > 0)
+            visit(vertex - 1, right[vertex - 1]);
+        if (row + 1 < side)
+            visit(vertex + side, down[vertex]);
+        if (row > 0)
+            visit(vertex - side, down[vertex - side]);
+    }
+};
+
+static unsigned long long checksumOf(const std::vector<uint32_t>& distances) {
+    unsigned long long sum = 0;
+    for (uint32_t distance : distances)
+        sum += distance;
+    return sum;
+}
+
+static std::vector<uint32_t> radixDijkstra(const Grid& grid) {
+    std::vector<uint32_t> distances(grid.right.size(), infinity);
+    RadixHeap<uint32_t, uint32_t> queue;
+    distances[0] = 0;
+    queue.insert(0, 0);
+    while (!queue.isEmpty()) {
+        std::pair<uint32_t, uint32_t> entry = queue.extractMin();
+        if (entry.first != distances[entry.second])
+            continue;
+        grid.forEachNeighbour(entry.second, [&](uint32_t neighbour, uint32_t weight) {
+            if (entry.first + weight < distances[neighbour]) {
+                distances[neighbour] = entry.first + weight;
+                queue.insert(distances[neighbour], neighbour);
+            }
+        });
+    }
+    return distances;
+}
+
+static std::vector<uint32_t> heapDijkstra(const Grid& grid) {
+    std::vector<uint32_t> distances(grid.right.size(), infinity);
+    Heap<std::pair<uint32_t, uint32_t>> queue;
+    distances[0] = 0;
+    queue.insert({0, 0});
+    while (!queue.isEmpty()) {
+        std::pair<uint32_t, uint32_t> entry = queue.extractExtremum();
+        if (entry.first != distances[entry.second])
+            continue;
+        grid.forEachNeighbour(entry.second, [&](uint32_t neighbour, uint32_t weight) {
+            if (entry.first + weight < distances[neighbour]) {
+                distances[neighbour] = entry.first + weight;
+                queue.insert({distances[neighbour], neighbour});
+            }
+        });
+    }
+    return distances;
+}
+
+int main(int argc, char** argv) {
+    Grid grid;
+    grid.side = static_cast<uint32_t>(argument(argc, argv, 1, 1000));
+    std::default_random_engine engine(40);
+    std::uniform_int_distribution<uint32_t> dist(1, 1000);
+    grid.right.resize(static_cast<size_t>(grid.side) * grid.side);
+    grid.down.resize(grid.right.size());
+    for (size_t i = 0; i < grid.right.size(); ++i) {
+        grid.right[i] = dist(engine);
+        grid.down[i] = dist(engine);
+    }
+
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        Stopwatch stopwatch;
+        checksum = checksumOf(radixDijkstra(grid));
+        return stopwatch.seconds();
+    });
+    report("Dijkstra with RadixHeap", seconds, checksum);
+
+    seconds = bestOf(3, [&]() {
+        Stopwatch stopwatch;
+        checksum = checksumOf(heapDijkstra(grid));
+        return stopwatch.seconds();
+    });
+    report("Dijkstra with Heap", seconds, checksum);
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Heap/Heap.h"
+
+// Inserts and extracts random 32 bit keys with wide heaps whose child selection uses AVX2 where the CPU has it,
+// and with the same heaps under a comparator the vector path does not recognise, which keeps the scalar loop.
+// Usage: SimdHeapBench [keys = 10000000]
+
+// Same order as std::less, but SimdChildSelector is only enabled for std::less and std::greater
+struct ScalarLess {
+    bool operator()(uint32_t first, uint32_t second) const {
+        return first < second;
+    }
+};
+
+template <class HeapType>
+static void run(const std::string& name, const std::vector<uint32_t>& keys) {
+    unsigned long long checksum = 0;
+    double seconds = bestOf(3, [&]() {
+        HeapType heap;
+        checksum = 0;
+        Stopwatch stopwatch;
+        for (uint32_t key : keys)
+            heap.insert(key);
+        while (!heap.isEmpty())
+            checksum = checksum * 31 + heap.extractExtremum();
+        return stopwatch.seconds();
+    });
+    report(name, seconds, checksum);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argument(argc, argv, 1, 10000000);
+    std::default_random_engine engine(43);
+    std::uniform_int_distribution<uint32_t> dist;
+    std::vector<uint32_t> keys(count);
+    for (uint32_t& key : keys)
+        key = dist(engine);
+
+    run<Heap<uint32_t>>("binary", keys);
+    run<DaryHeap<uint32_t, 8, ScalarLess>>("8-ary, scalar", keys);
+    run<DaryHeap<uint32_t, 8>>("8-ary, simd", keys);
+    run<DaryHeap<uint32_t, 16, ScalarLess>>("16-ary, scalar", keys);
+    run<DaryHeap<uint32_t, 16>>("16-ary, simd", keys);
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <set>
+
+#include "Heap/AddressableHeap.h"
+
+struct AddressableHeapTests : public testing::Test {
+    AddressableHeap<int> heap;
+    std::vector<AddressableHeap<int>::handle> handles;
+
+    virtual void SetUp() override {
+        for (int key : {50, 20, 80, 10, 70, 30, 60, 40})
+            handles.push_back(heap.insert(key));
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(AddressableHeapTests, BasicUsage) {
+    EXPECT_EQ(8u, heap.size());
+    EXPECT_EQ(10, heap.extremum());
+    EXPECT_EQ(80, heap.key(handles[2]));
+
+    EXPECT_EQ(10, heap.extractExtremum());
+    EXPECT_FALSE(heap.contains(handles[3]));
+    EXPECT_TRUE(heap.contains(handles[0]));
+    EXPECT_THROW(heap.key(handles[3]), std::runtime_error);
+
+    heap.clear();
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_FALSE(heap.contains(handles[0]));
+    EXPECT_THROW(heap.extractExtremum(), std::runtime_error);
+}
+
+TEST_F(AddressableHeapTests, DecreaseKey) {
+    heap.decreaseKey(handles[2], 5);  // 80 -> 5
+    EXPECT_EQ(5, heap.extremum());
+    EXPECT_EQ(5, heap.key(handles[2]));
+
+    heap.decreaseKey(handles[0], 50);  // Equal keys are allowed
+    EXPECT_THROW(heap.decreaseKey(handles[0], 55), std::runtime_error);
+
+    std::vector<int> expected = {5, 10, 20, 30, 40, 50, 60, 70};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractExtremum());
+}
+
+TEST_F(AddressableHeapTests, IncreaseKey) {
+    heap.increaseKey(handles[3], 65);  // 10 -> 65
+    EXPECT_EQ(20, heap.extremum());
+    EXPECT_THROW(heap.increaseKey(handles[3], 1), std::runtime_error);
+
+    std::vector<int> expected = {20, 30, 40, 50, 60, 65, 70, 80};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractExtremum());
+}
+
+TEST_F(AddressableHeapTests, Erase) {
+    heap.erase(handles[1]);  // 20
+    heap.erase(handles[3]);  // 10 (the extremum)
+    EXPECT_FALSE(heap.contains(handles[1]));
+    EXPECT_THROW(heap.erase(handles[1]), std::runtime_error);
+    EXPECT_EQ(6u, heap.size());
+
+    // The freed slots are reused, but the old handles stay invalid
+    auto newHandle = heap.insert(15);
+    EXPECT_TRUE(heap.contains(newHandle));
+    EXPECT_FALSE(heap.contains(handles[3]));
+    EXPECT_NE(newHandle, handles[3]);
+
+    std::vector<int> expected = {15, 30, 40, 50, 60, 70, 80};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractExtremum());
+}
+
+TEST_F(AddressableHeapTests, MaxHeap) {
+    AddressableHeap<int, std::greater<int>, 4> maxHeap;
+    auto h1 = maxHeap.insert(1);
+    maxHeap.insert(5);
+    maxHeap.insert(3);
+
+    maxHeap.decreaseKey(h1, 10);  // Towards the extremum, which is the maximum here
+    EXPECT_EQ(10, maxHeap.extractExtremum());
+    EXPECT_EQ(5, maxHeap.extractExtremum());
+}
+
+TEST_F(AddressableHeapTests, MoveOnlyKeys) {
+    auto comp = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    AddressableHeap<std::unique_ptr<int>, decltype(comp)> ptrHeap(comp);
+
+    std::vector<AddressableHeap<std::unique_ptr<int>, decltype(comp)>::handle> ptrHandles;
+    for (int key : {4, 2, 5, 1, 3})
+        ptrHandles.push_back(ptrHeap.insert(std::make_unique<int>(key)));
+    EXPECT_EQ(2, *ptrHeap.key(ptrHandles[1]));
+
+    ptrHeap.erase(ptrHandles[3]);
+    for (int i = 2; i <= 5; ++i)
+        EXPECT_EQ(i, *ptrHeap.extractExtremum());
+}
+
+TEST(AddressableHeapRandomTests, MixedOperations) {
+    const int samples = 2000;
+    std::default_random_engine engine(35);
+    std::uniform_int_distribution<int> dist(0, 10000);
+
+    AddressableHeap<int, std::less<int>, 3> heap;
+    std::multiset<int> reference;
+    std::vector<AddressableHeap<int, std::less<int>, 3>::handle> handles;
+
+    for (int i = 0; i < samples; ++i) {
+        int key = dist(engine);
+        handles.push_back(heap.insert(key));
+        reference.insert(key);
+    }
+
+    for (int i = 0; i < samples; ++i) {
+        auto h = handles[dist(engine) % handles.size()];
+        if (!heap.contains(h))
+            continue;
+
+        EXPECT_EQ(*reference.begin(), heap.extremum());
+
+        int oldKey = heap.key(h);
+        reference.erase(reference.find(oldKey));
+
+        switch (i % 3) {
+            case 0:
+                heap.decreaseKey(h, oldKey - dist(engine));
+                reference.insert(heap.key(h));
+                break;
+            case 1:
+                heap.increaseKey(h, oldKey + dist(engine));
+                reference.insert(heap.key(h));
+                break;
+            default:
+                heap.erase(h);
+                break;
+        }
+    }
+
+    EXPECT_EQ(reference.size(), heap.size());
+    for (int key : reference)
+        EXPECT_EQ(key, heap.extractExtremum());
+}
\ No newline at end of file
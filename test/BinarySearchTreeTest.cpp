@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <ctime>
+#include <functional>
+#include <numeric>
 #include <random>
 
 #include "BinarySearchTree/BinarySearchTree.h"
@@ -127,6 +131,149 @@ TEST_F(BinarySearchTreeTests, Postorder) {
     EXPECT_EQ(expected, vec);
 }
 
+TEST_F(BinarySearchTreeTests, LazyTraversals) {
+    std::vector<int> inorder(tree.inorderRange().begin(), tree.inorderRange().end());
+    EXPECT_EQ((std::vector<int>{10, 20, 30, 40, 50, 60, 70}), inorder);
+
+    std::vector<int> preorder(tree.preorderRange().begin(), tree.preorderRange().end());
+    EXPECT_EQ((std::vector<int>{40, 20, 10, 30, 60, 50, 70}), preorder);
+
+    std::vector<int> postorder(tree.postorderRange().begin(), tree.postorderRange().end());
+    EXPECT_EQ((std::vector<int>{10, 30, 20, 50, 70, 60, 40}), postorder);
+
+    std::vector<int> levelorder;
+    for (int key : tree.levelorderRange())
+        levelorder.push_back(key);
+    EXPECT_EQ((std::vector<int>{40, 20, 60, 10, 30, 50, 70}), levelorder);
+
+    // Stopping early only visits the consumed keys
+    std::vector<int> firstKeys;
+    for (int key : tree.preorderRange()) {
+        if (firstKeys.size() == 3)
+            break;
+        firstKeys.push_back(key);
+    }
+    EXPECT_EQ((std::vector<int>{40, 20, 10}), firstKeys);
+
+    tree.insert(45);
+    tree.insert(47);
+    std::vector<int> skewed(tree.postorderRange().begin(), tree.postorderRange().end());
+    EXPECT_EQ((std::vector<int>{10, 30, 20, 47, 45, 50, 70, 60, 40}), skewed);
+
+    BinarySearchTree<int> emptyTree;
+    EXPECT_TRUE(emptyTree.inorderRange().begin() == emptyTree.inorderRange().end());
+    EXPECT_TRUE(emptyTree.preorderRange().begin() == emptyTree.preorderRange().end());
+    EXPECT_TRUE(emptyTree.postorderRange().begin() == emptyTree.postorderRange().end());
+    EXPECT_TRUE(emptyTree.levelorderRange().begin() == emptyTree.levelorderRange().end());
+}
+
+TEST_F(BinarySearchTreeTests, DepthHistogram) {
+    std::vector<size_t> expected = {1, 2, 4};
+    EXPECT_EQ(expected, tree.computeDepthHistogram());
+
+    tree.insert(80);
+    expected = {1, 2, 4, 1};
+    EXPECT_EQ(expected, tree.computeDepthHistogram());
+
+    tree.clear();
+    EXPECT_TRUE(tree.computeDepthHistogram().empty());
+}
+
+TEST_F(BinarySearchTreeTests, FindMany) {
+    std::vector<int> keys = {70, 35, 10, 40, 10, 80, 50};
+    std::vector<BinarySearchTree<int>::iterator> result;
+    tree.findMany(keys, result);
+
+    ASSERT_EQ(keys.size(), result.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto expected = tree.find(keys[i]);
+        EXPECT_EQ(expected.isValid(), result[i].isValid());
+        if (expected.isValid()) {
+            EXPECT_EQ(keys[i], result[i].key());
+        }
+    }
+
+    tree.findMany(std::vector<int>(), result);
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(BinarySearchTreeTests, Count) {
+    EXPECT_EQ(1u, tree.count(30));
+    EXPECT_EQ(0u, tree.count(35));
+
+    tree.insert(30);
+    tree.insert(30);
+    EXPECT_EQ(3u, tree.count(30));
+    EXPECT_EQ(9u, tree.computeSize());
+}
+
+TEST_F(BinarySearchTreeTests, Multiset) {
+    MultiBinarySearchTree<int> multiTree;
+    multiTree.insert(40);
+    multiTree.insert(20);
+    multiTree.insert(60);
+    multiTree.insert(20);
+    multiTree.insert(20);
+    multiTree.insert(60);
+
+    // Copies share a node
+    EXPECT_EQ(2u, multiTree.computeHeight());
+    EXPECT_EQ(3u, multiTree.count(20));
+    EXPECT_EQ(2u, multiTree.count(60));
+    EXPECT_EQ(6u, multiTree.computeSize());
+
+    std::vector<int> expected = {20, 20, 20, 40, 60, 60};
+    EXPECT_EQ(expected, multiTree.inorder<std::vector<int>>());
+
+    std::vector<int> levelorder;
+    for (int key : multiTree.levelorderRange())
+        levelorder.push_back(key);
+    EXPECT_EQ((std::vector<int>{40, 20, 20, 20, 60, 60}), levelorder);
+
+    auto it = multiTree.find(20);
+    multiTree.erase(it);
+    EXPECT_TRUE(it.isValid());
+    EXPECT_EQ(2u, multiTree.count(20));
+
+    multiTree.erase(20);
+    multiTree.erase(20);
+    EXPECT_EQ(0u, multiTree.count(20));
+    EXPECT_FALSE(multiTree.root().left().isValid());
+
+    MultiBinarySearchTree<int> treeCpy(multiTree);
+    EXPECT_EQ(multiTree, treeCpy);
+    EXPECT_EQ(2u, treeCpy.count(60));
+
+    treeCpy.erase(60);
+    EXPECT_NE(multiTree, treeCpy);
+
+    EXPECT_EQ(60, multiTree.extractMax());
+    EXPECT_EQ(60, multiTree.extractMax());
+    EXPECT_EQ(40, multiTree.extractMax());
+    EXPECT_TRUE(multiTree.isEmpty());
+}
+
+#ifdef BST_ENABLE_STATS
+TEST_F(BinarySearchTreeTests, Stats) {
+    EXPECT_EQ(7u, tree.stats().inserts);
+    EXPECT_EQ(0u, tree.stats().rotations);
+
+    tree.resetStats();
+    tree.find(40);
+    EXPECT_EQ(1u, tree.stats().searches);
+    EXPECT_EQ(1u, tree.stats().maxSearchDepth);
+
+    tree.find(70);
+    EXPECT_EQ(2u, tree.stats().searches);
+    EXPECT_EQ(3u, tree.stats().maxSearchDepth);
+    EXPECT_EQ(2.0, tree.stats().averageSearchDepth());
+
+    tree.erase(10);
+    EXPECT_EQ(1u, tree.stats().erases);
+    EXPECT_EQ(3u, tree.stats().searches);
+}
+#endif
+
 struct BinarySearchTreeRandomTests : public testing::Test {
     int samples = 1000;
     std::default_random_engine engine = std::default_random_engine(time(nullptr));
@@ -145,6 +292,85 @@ struct BinarySearchTreeRandomTests : public testing::Test {
     }
 };
 
+TEST_F(BinarySearchTreeRandomTests, FindMany) {
+    std::vector<int> keys(samples);
+    for (int& key : keys)
+        key = dist(engine);
+
+    std::vector<BinarySearchTree<int>::iterator> result;
+    tree.findMany(keys, result);
+
+    for (int i = 0; i < samples; ++i) {
+        EXPECT_EQ(tree.find(keys[i]).isValid(), result[i].isValid());
+        if (result[i].isValid()) {
+            EXPECT_EQ(keys[i], result[i].key());
+        }
+    }
+}
+
+TEST_F(BinarySearchTreeRandomTests, LazyTraversals) {
+    std::vector<int> inorder(tree.inorderRange().begin(), tree.inorderRange().end());
+    EXPECT_EQ(static_cast<size_t>(samples), inorder.size());
+    EXPECT_TRUE(std::is_sorted(inorder.begin(), inorder.end()));
+
+    // Every traversal visits the same keys
+    std::vector<int> preorder(tree.preorderRange().begin(), tree.preorderRange().end());
+    std::vector<int> postorder(tree.postorderRange().begin(), tree.postorderRange().end());
+    std::vector<int> levelorder;
+    for (int key : tree.levelorderRange())
+        levelorder.push_back(key);
+
+    for (std::vector<int>* trav : {&preorder, &postorder, &levelorder}) {
+        std::sort(trav->begin(), trav->end());
+        EXPECT_EQ(inorder, *trav);
+    }
+
+    EXPECT_EQ(tree.root().key(), *tree.preorderRange().begin());
+    EXPECT_EQ(tree.root().key(), *tree.levelorderRange().begin());
+}
+
+TEST_F(BinarySearchTreeRandomTests, ParallelForEach) {
+    std::atomic<long long> sum(0);
+    std::atomic<int> calls(0);
+    tree.parallelForEach([&](int key) {
+        sum += key;
+        ++calls;
+    }, 4);
+
+    auto keys = tree.inorder<std::vector<int>>();
+    EXPECT_EQ(std::accumulate(keys.begin(), keys.end(), 0LL), sum);
+    EXPECT_EQ(samples, calls);
+}
+
+TEST_F(BinarySearchTreeRandomTests, ParallelReduce) {
+    auto keys = tree.inorder<std::vector<int>>();
+
+    for (size_t threads : {1, 3, 8}) {
+        long long sum = tree.parallelReduce(0LL, [](long long acc, int key) { return acc + key; }, std::plus<long long>(), threads);
+        EXPECT_EQ(std::accumulate(keys.begin(), keys.end(), 0LL), sum);
+
+        // Concatenation is not commutative, so this only works if the parts are joined in key order
+        auto concatenated = tree.parallelReduce(std::vector<int>(),
+            [](std::vector<int> acc, int key) {
+                acc.push_back(key);
+                return acc;
+            },
+            [](std::vector<int> first, std::vector<int> second) {
+                first.insert(first.end(), second.begin(), second.end());
+                return first;
+            }, threads);
+        EXPECT_EQ(keys, concatenated);
+    }
+
+    BinarySearchTree<int> emptyTree;
+    EXPECT_EQ(42, emptyTree.parallelReduce(42, [](int acc, int key) { return acc + key; }, std::plus<int>(), 4));
+
+    EXPECT_THROW(tree.parallelForEach([](int key) {
+        if (key >= 0)
+            throw std::runtime_error("Test");
+    }, 4), std::runtime_error);
+}
+
 TEST_F(BinarySearchTreeRandomTests, ExtractMax) {
     int lastMax = std::numeric_limits<int>::max();
     while (!tree.isEmpty()) {
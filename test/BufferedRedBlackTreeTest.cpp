@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "BinarySearchTree/BufferedRedBlackTree.h"
+
+struct BufferedRedBlackTreeTests : public testing::Test {
+    BufferedRedBlackTree<int> tree = BufferedRedBlackTree<int>(4);
+
+    virtual void SetUp() override {
+        for (int key : {40, 20, 60, 10, 30, 50, 70})
+            tree.insert(key);
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(BufferedRedBlackTreeTests, BasicUsage) {
+    // Don't use predeclared Stuff
+    BufferedRedBlackTree<double> myTree;
+    myTree.insert(5);
+    myTree.insert(2.5);
+    myTree.insert(7.5);
+
+    EXPECT_EQ(3u, myTree.size());
+    EXPECT_TRUE(myTree.contains(2.5));
+    EXPECT_FALSE(myTree.contains(3));
+
+    // Nothing reached the tree yet
+    EXPECT_FALSE(myTree.tree().isEmpty());
+    EXPECT_EQ(5, myTree.tree().root().key());
+    EXPECT_EQ(3u, myTree.size());
+}
+
+TEST_F(BufferedRedBlackTreeTests, Lookup) {
+    for (int key : {10, 20, 30, 40, 50, 60, 70})
+        EXPECT_TRUE(tree.contains(key));
+    EXPECT_FALSE(tree.contains(35));
+
+    tree.insert(30);
+    EXPECT_EQ(2u, tree.count(30));
+    EXPECT_EQ(0u, tree.count(35));
+}
+
+TEST_F(BufferedRedBlackTreeTests, Inorder) {
+    std::vector<int> expected = {10, 20, 30, 40, 50, 60, 70};
+    EXPECT_EQ(expected, tree.inorder<std::vector<int>>());
+
+    tree.flush();
+    EXPECT_EQ(expected, tree.inorder<std::vector<int>>());
+    EXPECT_EQ(expected, tree.tree().inorder<std::vector<int>>());
+}
+
+TEST_F(BufferedRedBlackTreeTests, Deletion) {
+    tree.erase(70);  // Still in the unsorted buffer
+    tree.erase(10);
+    tree.erase(35);
+    EXPECT_EQ(5u, tree.size());
+    EXPECT_FALSE(tree.contains(70));
+    EXPECT_FALSE(tree.contains(10));
+
+    tree.flush();
+    tree.erase(40);
+    EXPECT_EQ(4u, tree.size());
+
+    std::vector<int> expected = {20, 30, 50, 60};
+    EXPECT_EQ(expected, tree.inorder<std::vector<int>>());
+
+    tree.clear();
+    EXPECT_TRUE(tree.isEmpty());
+}
+
+TEST(BufferedRedBlackTreeRandomTests, MatchesSortedKeys) {
+    std::default_random_engine engine(31);
+    std::uniform_int_distribution<int> dist(0, 1000);
+
+    BufferedRedBlackTree<int> tree(16);
+    std::vector<int> keys;
+    for (int i = 0; i < 5000; ++i) {
+        int key = dist(engine);
+        tree.insert(key);
+        keys.push_back(key);
+
+        if (i % 7 == 0) {
+            int toErase = dist(engine);
+            auto it = std::find(keys.begin(), keys.end(), toErase);
+            if (it != keys.end())
+                keys.erase(it);
+            tree.erase(toErase);
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(keys.size(), tree.size());
+    EXPECT_EQ(keys, tree.inorder<std::vector<int>>());
+    for (int key = 0; key <= 1000; key += 10)
+        EXPECT_EQ(static_cast<size_t>(std::count(keys.begin(), keys.end(), key)), tree.count(key));
+
+    const RedBlackTree<int>& flushed = tree.tree();
+    EXPECT_EQ(keys, flushed.inorder<std::vector<int>>());
+    EXPECT_LE(flushed.computeHeight(), 2 * log2(keys.size() + 1) + 1);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Heap/ExternalHeap.h"
+
+struct ExternalHeapTests : public testing::Test {
+    std::filesystem::path directory;
+    ExternalHeapConfig config;
+
+    virtual void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / ("ExternalHeapTests-" + std::to_string(std::random_device()()));
+        std::filesystem::create_directory(directory);
+
+        config.tempDirectory = directory;
+        config.memoryBudget = 4 * sizeof(int);
+        config.ioBufferSize = 3 * sizeof(int);
+        config.mergeFanIn = 3;
+    }
+
+    virtual void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    size_t fileCount() const {
+        return std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator());
+    }
+};
+
+TEST_F(ExternalHeapTests, BasicUsage) {
+    ExternalHeap<int> heap(config);
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.extremum(), std::runtime_error);
+    EXPECT_THROW(heap.extractExtremum(), std::runtime_error);
+
+    for (int key : {5, 3, 9, 1})
+        heap.insert(key);
+    EXPECT_EQ(0u, heap.runCount());  // Fits into the memory budget
+
+    heap.insert(7);
+    EXPECT_EQ(1u, heap.runCount());
+    EXPECT_EQ(1u, fileCount());
+    EXPECT_EQ(5u, heap.size());
+
+    EXPECT_EQ(1, heap.extremum());
+    std::vector<int> expected = {1, 3, 5, 7, 9};
+    std::vector<int> extracted;
+    while (!heap.isEmpty())
+        extracted.push_back(heap.extractExtremum());
+    EXPECT_EQ(expected, extracted);
+    EXPECT_EQ(0u, heap.runCount());
+    EXPECT_EQ(0u, fileCount());  // Used up runs remove their files
+
+    EXPECT_THROW(ExternalHeap<int>(ExternalHeapConfig{0, directory, 0, 1}), std::runtime_error);
+}
+
+TEST_F(ExternalHeapTests, Spilling) {
+    ExternalHeap<int, std::greater<int>> heap(config);
+    for (int i = 0; i < 100; ++i)
+        heap.insert((i * 37) % 100);
+
+    // The 24 spills are 220 in base 3, so two runs of 9 spills and two runs of 3 spills are left
+    EXPECT_EQ(4u, heap.runCount());
+    EXPECT_EQ(heap.runCount(), fileCount());
+
+    // Inserting between extractions mixes the buffer with partially read runs
+    for (int expected = 99; expected >= 50; --expected)
+        EXPECT_EQ(expected, heap.extractExtremum());
+    for (int key : {75, 10, 60})
+        heap.insert(key);
+
+    std::vector<int> expected = {75, 60};
+    for (int key = 49; key >= 10; --key)
+        expected.push_back(key);
+    expected.push_back(10);
+    for (int key = 9; key >= 0; --key)
+        expected.push_back(key);
+
+    std::vector<int> extracted;
+    while (!heap.isEmpty())
+        extracted.push_back(heap.extractExtremum());
+    EXPECT_EQ(expected, extracted);
+}
+
+TEST_F(ExternalHeapTests, Clear) {
+    {
+        ExternalHeap<int> heap(config);
+        for (int i = 0; i < 20; ++i)
+            heap.insert(i);
+        EXPECT_LT(0u, fileCount());
+
+        heap.clear();
+        EXPECT_EQ(0u, fileCount());
+        EXPECT_TRUE(heap.isEmpty());
+
+        for (int i = 0; i < 20; ++i)
+            heap.insert(i);
+    }
+    EXPECT_EQ(0u, fileCount());  // The destructor removes the remaining runs
+
+    config.tempDirectory = directory / "missing";
+    ExternalHeap<int> heap(config);
+    for (int i = 0; i < 4; ++i)
+        heap.insert(i);
+    EXPECT_THROW(heap.insert(4), std::runtime_error);
+}
+
+struct ExternalHeapRandomTests : public ExternalHeapTests {
+    int samples = 100000;
+    std::default_random_engine engine = std::default_random_engine(44);
+    std::uniform_int_distribution<int> dist = std::uniform_int_distribution<int>(0, 1000000);
+};
+
+TEST_F(ExternalHeapRandomTests, AgainstHeap) {
+    config.memoryBudget = 1000 * sizeof(int);
+    config.ioBufferSize = 256 * sizeof(int);
+    config.mergeFanIn = 4;
+
+    ExternalHeap<int> external(config);
+    Heap<int> heap;
+    for (int i = 0; i < samples; ++i) {
+        if (dist(engine) % 4 == 0 && !heap.isEmpty()) {
+            ASSERT_EQ(heap.extractExtremum(), external.extractExtremum());
+        } else {
+            int key = dist(engine);
+            heap.insert(key);
+            external.insert(key);
+        }
+        ASSERT_EQ(heap.size(), external.size());
+    }
+
+    while (!heap.isEmpty())
+        ASSERT_EQ(heap.extractExtremum(), external.extractExtremum());
+    EXPECT_EQ(0u, fileCount());
+}
\ No newline at end of file
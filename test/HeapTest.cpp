@@ -1,5 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
 #include "Heap/Heap.h"
 
 struct HeapTests : public testing::Test {
@@ -24,4 +34,238 @@ TEST_F(HeapTests, BasicUsage) {
     EXPECT_EQ(myHeap.extractExtremum(), 12.3);
     EXPECT_EQ(myHeap.extractExtremum(), 5.1);
     EXPECT_EQ(myHeap.extractExtremum(), 3.3);
+}
+
+template <class HeapType>
+static void expectSortedExtraction(HeapType& heap, std::vector<int> keys) {
+    for (int key : keys)
+        heap.insert(key);
+
+    std::sort(keys.begin(), keys.end());
+    for (int key : keys)
+        EXPECT_EQ(key, heap.extractExtremum());
+    EXPECT_EQ(0u, heap.size());
+}
+
+TEST_F(HeapTests, Arity) {
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int> dist(0, 500);
+    std::vector<int> keys(1000);
+    for (int& key : keys)
+        key = dist(engine);
+
+    expectSortedExtraction(heap, keys);
+
+    Heap<int, std::less<int>, std::vector<int>, 3> ternaryHeap;
+    expectSortedExtraction(ternaryHeap, keys);
+
+    DaryHeap<int, 4> quaternaryHeap;
+    expectSortedExtraction(quaternaryHeap, keys);
+
+    DaryHeap<int, 8> octonaryHeap;
+    expectSortedExtraction(octonaryHeap, keys);
+
+    DaryHeap<int, 4, std::greater<int>> maxHeap = {3, 9, 1, 7, 5, 8, 2, 6, 4};
+    for (int i = 9; i > 0; --i)
+        EXPECT_EQ(i, maxHeap.extractExtremum());
+}
+
+TEST_F(HeapTests, CacheAlignedAllocator) {
+    CacheAlignedAllocator<int> allocator;
+    for (size_t n : {1, 3, 100}) {
+        int* ptr = allocator.allocate(n);
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(ptr) % 64);
+        allocator.deallocate(ptr, n);
+    }
+
+    std::vector<double, CacheAlignedAllocator<double>> vec(10, 1.5);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(vec.data()) % 64);
+
+    // With an offset of 1, the children of every node of a 16-ary heap of ints fill exactly one cache line
+    std::vector<int, CacheAlignedAllocator<int, 64, 1>> children(1 + 16 * 20);
+    for (size_t first = 1; first < children.size(); first += 16)
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&children[first]) % 64);
+    children.resize(1000);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&children[1]) % 64);
+}
+
+TEST_F(HeapTests, MoveOperations) {
+    Heap<std::string> stringHeap;
+    std::string banana = "banana";
+    stringHeap.insert(std::move(banana));
+    stringHeap.emplace(3, 'c');
+    stringHeap.insert("apple");
+
+    EXPECT_EQ("apple", stringHeap.extremum());
+    EXPECT_EQ(3u, stringHeap.size());
+
+    EXPECT_EQ("aardvark", stringHeap.insertAndExtract("aardvark"));  // Never enters the heap
+    EXPECT_EQ("apple", stringHeap.insertAndExtract("cherry"));
+    EXPECT_EQ("banana", stringHeap.replaceExtremum("avocado"));
+    EXPECT_EQ("avocado", stringHeap.extractExtremum());
+    EXPECT_EQ("ccc", stringHeap.extractExtremum());
+    EXPECT_EQ("cherry", stringHeap.extractExtremum());
+    EXPECT_TRUE(stringHeap.isEmpty());
+
+    EXPECT_THROW(stringHeap.extremum(), std::runtime_error);
+    EXPECT_THROW(stringHeap.extractExtremum(), std::runtime_error);
+    EXPECT_THROW(stringHeap.replaceExtremum("x"), std::runtime_error);
+    EXPECT_EQ("x", stringHeap.insertAndExtract("x"));
+
+    // Elements only have to be movable
+    auto comp = [](const std::unique_ptr<int>& first, const std::unique_ptr<int>& second) { return *first < *second; };
+    Heap<std::unique_ptr<int>, decltype(comp), std::vector<std::unique_ptr<int>>, 4> ptrHeap(comp);
+    for (int i : {5, 2, 8, 1, 9, 3})
+        ptrHeap.emplace(new int(i));
+    ptrHeap.insert(std::make_unique<int>(7));
+
+    EXPECT_EQ(0, *ptrHeap.insertAndExtract(std::make_unique<int>(0)));
+    EXPECT_EQ(1, *ptrHeap.replaceExtremum(std::make_unique<int>(6)));
+    for (int i : {2, 3, 5, 6, 7, 8, 9})
+        EXPECT_EQ(i, *ptrHeap.extractExtremum());
+}
+
+TEST_F(HeapTests, BulkConstruction) {
+    std::vector<int> keys = {9, 4, 7, 1, 8, 2, 6, 3, 5};
+    std::vector<int> data = keys;
+    Heap<int> vectorHeap(std::move(data));
+    EXPECT_EQ(9u, vectorHeap.size());
+
+    std::list<int> list(keys.begin(), keys.end());
+    Heap<int, std::greater<int>, std::vector<int>, 3> rangeHeap(list.begin(), list.end());
+
+    for (int i = 1; i <= 9; ++i) {
+        EXPECT_EQ(i, vectorHeap.extractExtremum());
+        EXPECT_EQ(10 - i, rangeHeap.extractExtremum());
+    }
+
+    // Large enough to be built subtree by subtree when assign() may use several threads
+    std::default_random_engine engine(7);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+    std::vector<int> largeKeys(200000);
+    for (int& key : largeKeys)
+        key = dist(engine);
+
+    DaryHeap<int, 4> largeHeap(largeKeys.begin(), largeKeys.end());
+    DaryHeap<int, 4> parallelHeap;
+    parallelHeap.assign(std::vector<int, CacheAlignedAllocator<int, 64, 1>>(largeKeys.begin(), largeKeys.end()), 4);
+    EXPECT_EQ(largeKeys.size(), parallelHeap.size());
+
+    // More threads than elements only get as many threads as there are large enough subtrees
+    Heap<int, std::less<int>, std::vector<int>, 2> crowdedHeap;
+    crowdedHeap.assign(std::vector<int>(largeKeys.begin(), largeKeys.begin() + 70000), largeKeys.size());
+    EXPECT_EQ(70000u, crowdedHeap.size());
+    std::vector<int> crowdedKeys(largeKeys.begin(), largeKeys.begin() + 70000);
+    std::sort(crowdedKeys.begin(), crowdedKeys.end());
+    for (int key : crowdedKeys)
+        ASSERT_EQ(key, crowdedHeap.extractExtremum());
+
+    std::sort(largeKeys.begin(), largeKeys.end());
+    for (int key : largeKeys) {
+        ASSERT_EQ(key, largeHeap.extractExtremum());
+        ASSERT_EQ(key, parallelHeap.extractExtremum());
+    }
+}
+
+TEST_F(HeapTests, Merge) {
+    heap = {10, 30, 50};
+    Heap<int> small = {20};
+    heap.merge(std::move(small));
+    EXPECT_TRUE(small.isEmpty());
+
+    Heap<int> large = {60, 5, 40, 25, 15, 35, 45, 55};
+    heap.merge(std::move(large));
+    EXPECT_EQ(12u, heap.size());
+
+    std::vector<int> expected = {5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractExtremum());
+}
+
+TEST_F(HeapTests, BatchExtraction) {
+    heap = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+    std::vector<int> extracted;
+    heap.extractN(2, std::back_inserter(extracted));  // Extracted one by one
+    heap.extractN(5, std::back_inserter(extracted));  // Partitioned
+    std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(expected, extracted);
+    EXPECT_EQ(3u, heap.size());
+    EXPECT_EQ(7, heap.extremum());
+
+    heap.insert(-1);
+    heap.extractN(10, std::back_inserter(extracted));
+    expected = {0, 1, 2, 3, 4, 5, 6, -1, 7, 8, 9};
+    EXPECT_EQ(expected, extracted);
+    EXPECT_TRUE(heap.isEmpty());
+
+    Heap<std::string, std::greater<std::string>> strings = {"b", "d", "a", "c"};
+    strings.sortInPlace();
+    strings.insert("e");  // Still a valid heap after sorting
+    std::vector<std::string> expectedStrings = {"e", "d", "c", "b", "a"};
+    EXPECT_EQ(expectedStrings, strings.intoSortedVector());
+    EXPECT_TRUE(strings.isEmpty());
+
+    std::default_random_engine engine(7);
+    std::uniform_int_distribution<int> dist(-100000, 100000);
+    std::vector<int> keys(size_t(1) << 17);
+    for (int& key : keys)
+        key = dist(engine);
+
+    for (size_t threads : {1, 3, 0}) {
+        DaryHeap<int, 4> large(keys.begin(), keys.end());
+        large.sortInPlace(threads);
+        large.insert(0);
+        std::vector<int> sorted = keys;
+        sorted.push_back(0);
+        std::sort(sorted.begin(), sorted.end());
+        auto result = large.intoSortedVector(threads);
+        EXPECT_TRUE(std::equal(sorted.begin(), sorted.end(), result.begin(), result.end()));
+    }
+}
+
+template <typename T, class Comp>
+static void expectSameChildAsScalar(const std::vector<T>& keys) {
+    size_t offset = SimdChildSelector<T, Comp>::select(keys.data(), keys.size());
+    if (offset == SimdChildSelector<T, Comp>::npos)
+        return;  // No AVX2 on this CPU
+
+    size_t expected = 0;
+    for (size_t i = 1; i < keys.size(); ++i) {
+        if (Comp()(keys[i], keys[expected]))
+            expected = i;
+    }
+    EXPECT_EQ(expected, offset);
+}
+
+TEST_F(HeapTests, SimdChildSelection) {
+    expectSameChildAsScalar<uint32_t, std::less<uint32_t>>({7, 3, 9, 3, 4294967295u, 8, 5, 6});
+    expectSameChildAsScalar<uint32_t, std::greater<uint32_t>>({7, 3, 9, 3, 4294967295u, 8, 5, 4294967295u});
+    expectSameChildAsScalar<int32_t, std::less<int32_t>>({7, -3, 9, 3, 0, 8, -5, 6, 1, 2, -5, 4, 0, 0, 9, 1});
+    expectSameChildAsScalar<int32_t, std::greater<int32_t>>({7, -3, 9, 3, 0, 8, -5, 6, 1, 2, -5, 4, 0, 0, 11, 1});
+    expectSameChildAsScalar<float, std::less<float>>({1.5f, -2.5f, 0.0f, -0.0f, 3.0f, -2.5f, 8.0f, 1.0f});
+    expectSameChildAsScalar<float, std::greater<float>>({1.5f, -2.5f, 0.0f, -0.0f, 3.0f, -2.5f, 8.0f, 1.0f, 9.5f, 2, 3, 4, 5, 6, 7, 8});
+
+    std::default_random_engine engine(11);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    std::vector<int> keys(5000);
+    for (int& key : keys)
+        key = dist(engine);
+
+    DaryHeap<int32_t, 8> heap8;
+    expectSortedExtraction(heap8, keys);
+    DaryHeap<int32_t, 16> heap16;
+    expectSortedExtraction(heap16, keys);
+
+    DaryHeap<float, 16, std::greater<float>> floatHeap;
+    DaryHeap<uint32_t, 8, std::greater<uint32_t>> unsignedHeap;
+    for (int key : keys) {
+        floatHeap.insert(key / 4.0f);
+        unsignedHeap.insert(static_cast<uint32_t>(key + 1000));
+    }
+
+    std::sort(keys.begin(), keys.end(), std::greater<int>());
+    for (int key : keys) {
+        EXPECT_EQ(key / 4.0f, floatHeap.extractExtremum());
+        EXPECT_EQ(static_cast<uint32_t>(key + 1000), unsignedHeap.extractExtremum());
+    }
 }
\ No newline at end of file
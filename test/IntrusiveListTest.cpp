@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "LinkedList/IntrusiveList.h"
+
+struct IdleTag;
+
+struct Connection : public IntrusiveListHook<>, public IntrusiveListHook<IdleTag> {
+    int id;
+
+    Connection(int _id) : id(_id) {}
+};
+
+struct IntrusiveListTests : public testing::Test {
+    std::vector<std::unique_ptr<Connection>> pool;
+    IntrusiveList<Connection> lst;
+
+    virtual void SetUp() override {
+        for (int i = 0; i < 10; ++i)
+            pool.push_back(std::make_unique<Connection>(i));
+        for (int i = 1; i <= 5; ++i)
+            lst.append(*pool[i]);
+    }
+
+    virtual void TearDown() override {
+    }
+
+    template <class List>
+    static std::vector<int> ids(const List& list) {
+        std::vector<int> result;
+        for (const Connection& connection : list)
+            result.push_back(connection.id);
+        return result;
+    }
+};
+
+TEST_F(IntrusiveListTests, Insertion) {
+    std::vector<int> expected = {1, 2, 3, 4, 5};
+    EXPECT_EQ(expected, ids(lst));
+    EXPECT_EQ(5, lst.computeSize());
+    EXPECT_EQ(&*pool[1], &*lst.begin());  // The elements themselves are linked
+
+    lst.insert(*pool[0], lst.begin());
+    lst.insert(*pool[6], ++++lst.begin());
+    lst.insert(*pool[7], lst.end());
+    expected = {0, 1, 6, 2, 3, 4, 5, 7};
+    EXPECT_EQ(expected, ids(lst));
+    EXPECT_EQ(7, (--lst.end())->id);
+
+    EXPECT_THROW(lst.append(*pool[3]), std::runtime_error);
+}
+
+TEST_F(IntrusiveListTests, Deletion) {
+    lst.erase(++++lst.begin());
+    pool[1]->IntrusiveListHook<>::unlink();  // Elements can leave without the list
+
+    auto it = lst.begin();
+    while (it.next().isValid())
+        ++it;
+    lst.erase(it);
+
+    std::vector<int> expected = {2, 4};
+    EXPECT_EQ(expected, ids(lst));
+    EXPECT_FALSE(pool[5]->IntrusiveListHook<>::isLinked());
+
+    pool[2].reset();  // Destroyed elements unlink themselves
+    expected = {4};
+    EXPECT_EQ(expected, ids(lst));
+
+    lst.clear();
+    EXPECT_TRUE(lst.isEmpty());
+    EXPECT_FALSE(pool[4]->IntrusiveListHook<>::isLinked());
+}
+
+TEST_F(IntrusiveListTests, RangeDeletion) {
+    lst.erase(++lst.begin(), --lst.end());
+    std::vector<int> expected = {1, 5};
+    EXPECT_EQ(expected, ids(lst));
+    EXPECT_FALSE(pool[3]->IntrusiveListHook<>::isLinked());
+
+    lst.erase(lst.begin(), lst.end());
+    EXPECT_TRUE(lst.isEmpty());
+
+    lst.append(*pool[3]);  // Erased elements can be linked again
+    EXPECT_EQ(1, lst.computeSize());
+}
+
+TEST_F(IntrusiveListTests, SpliceAndMove) {
+    IntrusiveList<Connection> other;
+    for (int i = 6; i <= 9; ++i)
+        other.append(*pool[i]);
+
+    lst.splice(++lst.begin(), other, ++other.begin(), --other.end());
+    std::vector<int> expected = {1, 7, 8, 2, 3, 4, 5};
+    EXPECT_EQ(expected, ids(lst));
+    expected = {6, 9};
+    EXPECT_EQ(expected, ids(other));
+
+    lst.splice(lst.end(), other);
+    EXPECT_TRUE(other.isEmpty());
+    expected = {1, 7, 8, 2, 3, 4, 5, 6, 9};
+    EXPECT_EQ(expected, ids(lst));
+
+    IntrusiveList<Connection> moved(std::move(lst));
+    EXPECT_TRUE(lst.isEmpty());
+    EXPECT_EQ(expected, ids(moved));
+    pool[9]->IntrusiveListHook<>::unlink();
+    EXPECT_EQ(6, (--moved.end())->id);
+
+    lst = std::move(moved);
+    EXPECT_EQ(8, lst.computeSize());
+    EXPECT_TRUE(moved.isEmpty());
+}
+
+TEST_F(IntrusiveListTests, IteratorAfterSplice) {
+    IntrusiveList<Connection> other;
+    for (int i = 6; i <= 8; ++i)
+        other.append(*pool[i]);
+
+    // Taken before the splice, the iterator has to stop at the end of the list its elements moved to
+    auto it = ++other.begin();
+    lst.splice(lst.end(), other, it, other.end());
+
+    std::vector<int> walked;
+    while (it.isValid()) {
+        walked.push_back(it->id);
+        ++it;
+    }
+    std::vector<int> expected = {7, 8};
+    EXPECT_EQ(expected, walked);
+    EXPECT_TRUE(it == lst.end());
+    EXPECT_THROW(++it, std::runtime_error);
+    EXPECT_EQ(8, (--it)->id);
+}
+
+TEST_F(IntrusiveListTests, SeveralLists) {
+    IntrusiveList<Connection, IdleTag> idle;
+    idle.append(*pool[4]);
+    idle.append(*pool[2]);
+    idle.append(*pool[8]);
+
+    std::vector<int> expected = {4, 2, 8};
+    EXPECT_EQ(expected, ids(idle));
+    expected = {1, 2, 3, 4, 5};
+    EXPECT_EQ(expected, ids(lst));
+
+    idle.erase(idle.begin());
+    EXPECT_TRUE(pool[4]->IntrusiveListHook<>::isLinked());
+    EXPECT_FALSE(pool[4]->IntrusiveListHook<IdleTag>::isLinked());
+
+    pool[2].reset();
+    expected = {8};
+    EXPECT_EQ(expected, ids(idle));
+    expected = {1, 3, 4, 5};
+    EXPECT_EQ(expected, ids(lst));
+}
+
+TEST(IntrusiveListRandomTests, AgainstList) {
+    const int samples = 20000;
+    std::default_random_engine engine(48);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+
+    std::vector<Connection> pool;
+    for (int i = 0; i < 200; ++i)
+        pool.emplace_back(i);
+
+    IntrusiveList<Connection> lst;
+    std::list<int> expected;
+    for (int i = 0; i < samples; ++i) {
+        Connection& connection = pool[dist(engine) % pool.size()];
+        if (connection.IntrusiveListHook<>::isLinked()) {
+            connection.IntrusiveListHook<>::unlink();
+            expected.remove(connection.id);
+            continue;
+        }
+
+        int position = dist(engine) % (expected.size() + 1);
+        auto it = lst.begin();
+        auto expectedIt = expected.begin();
+        for (int j = 0; j < position; ++j, ++it, ++expectedIt) {}
+        lst.insert(connection, it);
+        expected.insert(expectedIt, connection.id);
+    }
+
+    std::vector<int> actual;
+    for (const Connection& connection : lst)
+        actual.push_back(connection.id);
+    EXPECT_EQ(std::vector<int>(expected.begin(), expected.end()), actual);
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Heap/KWayMerger.h"
+
+struct KWayMergerTests : public testing::Test {
+    std::vector<std::vector<int>> runs = {{1, 4, 7}, {}, {2, 5, 8, 9}, {3, 6}};
+
+    virtual void SetUp() override {
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(KWayMergerTests, BasicUsage) {
+    using It = std::vector<int>::const_iterator;
+    std::vector<std::pair<It, It>> sources;
+    for (const auto& run : runs)
+        sources.emplace_back(run.begin(), run.end());
+
+    KWayMerger<It> merger(sources);
+    EXPECT_EQ(3u, merger.activeSources());
+    EXPECT_EQ(1, merger.peek());
+    EXPECT_EQ(1, merger.next());
+    EXPECT_EQ(2, merger.next());
+
+    std::vector<int> merged;
+    merger.mergeInto(std::back_inserter(merged));
+    std::vector<int> expected = {3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(expected, merged);
+    EXPECT_TRUE(merger.isEmpty());
+    EXPECT_THROW(merger.peek(), std::runtime_error);
+    EXPECT_THROW(merger.next(), std::runtime_error);
+}
+
+TEST_F(KWayMergerTests, StableAndDescending) {
+    using Entry = std::pair<int, char>;
+    struct ByKey {
+        bool operator()(const Entry& lhs, const Entry& rhs) const {
+            return lhs.first > rhs.first;
+        }
+    };
+
+    std::list<Entry> first = {{5, 'a'}, {3, 'a'}, {3, 'b'}};
+    std::list<Entry> second = {{5, 'c'}, {3, 'c'}, {1, 'c'}};
+    KWayMerger<std::list<Entry>::iterator, ByKey> merger;
+    merger.addSource(first.begin(), first.end());
+    merger.addSource(second.begin(), second.end());
+
+    std::vector<Entry> merged;
+    merger.mergeInto(std::back_inserter(merged));
+    std::vector<Entry> expected = {{5, 'a'}, {5, 'c'}, {3, 'a'}, {3, 'b'}, {3, 'c'}, {1, 'c'}};
+    EXPECT_EQ(expected, merged);
+}
+
+TEST_F(KWayMergerTests, MovesAndStreams) {
+    std::vector<std::unique_ptr<int>> left, right;
+    for (int key : {1, 3})
+        left.push_back(std::make_unique<int>(key));
+    for (int key : {2, 4})
+        right.push_back(std::make_unique<int>(key));
+
+    auto byValue = [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) {
+        return *lhs < *rhs;
+    };
+    using It = std::move_iterator<std::vector<std::unique_ptr<int>>::iterator>;
+    KWayMerger<It, decltype(byValue)> merger(byValue);
+    merger.addSource(std::make_move_iterator(left.begin()), std::make_move_iterator(left.end()));
+    merger.addSource(std::make_move_iterator(right.begin()), std::make_move_iterator(right.end()));
+
+    for (int expected = 1; expected <= 4; ++expected)
+        EXPECT_EQ(expected, *merger.next());
+    EXPECT_EQ(nullptr, left[0]);  // Moved out, not copied
+
+    std::istringstream firstStream("a c e"), secondStream("b d");
+    using StreamIt = std::istream_iterator<std::string>;
+    KWayMerger<StreamIt> streams;
+    streams.addSource(StreamIt(firstStream), StreamIt());
+    streams.addSource(StreamIt(secondStream), StreamIt());
+
+    std::vector<std::string> merged;
+    streams.mergeInto(std::back_inserter(merged));
+    std::vector<std::string> expected = {"a", "b", "c", "d", "e"};
+    EXPECT_EQ(expected, merged);
+}
+
+TEST(KWayMergerRandomTests, AgainstSort) {
+    const int samples = 100000;
+    std::default_random_engine engine(46);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+
+    std::vector<std::vector<int>> runs(300);
+    std::vector<int> expected;
+    for (int i = 0; i < samples; ++i) {
+        int key = dist(engine);
+        runs[dist(engine) % runs.size()].push_back(key);
+        expected.push_back(key);
+    }
+    for (auto& run : runs)
+        std::sort(run.begin(), run.end());
+    std::sort(expected.begin(), expected.end());
+
+    KWayMerger<std::vector<int>::iterator> merger;
+    for (auto& run : runs)
+        merger.addSource(run.begin(), run.end());
+
+    std::vector<int> merged;
+    merger.mergeInto(std::back_inserter(merged));
+    EXPECT_EQ(expected, merged);
+}
\ No newline at end of file
@@ -1,5 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "LinkedList/LinkedList.h"
 
 struct LinkedListTests : public testing::Test {
@@ -95,6 +103,165 @@ TEST_F(LinkedListTests, Deletion) {
     EXPECT_EQ(4, *++lst.begin());
 }
 
+TEST_F(LinkedListTests, LongListTeardown) {
+    // A recursive teardown would overflow the stack long before this many nodes
+    const int count = 1000000;
+    for (int i = 0; i < count; ++i)
+        lst.append(i);
+
+    auto it = ++lst.begin();
+    lst.erase(it, lst.end());
+    EXPECT_EQ(1, lst.computeSize());
+
+    for (int i = 0; i < count; ++i)
+        lst.append(i);
+    lst.clear();
+    EXPECT_TRUE(lst.isEmpty());
+
+    LinkedList<int> other;
+    for (int i = 0; i < count; ++i)
+        other.append(i);
+    lst = other;
+    lst = std::move(other);
+    EXPECT_EQ(count, lst.computeSize());
+}
+
+TEST_F(LinkedListTests, Reclaimer) {
+    auto tracker = std::make_shared<int>(0);
+    LinkedList<std::shared_ptr<int>> tracked;
+    for (int i = 0; i < 100000; ++i)
+        tracked.append(tracker);
+
+    ListReclaimer reclaimer;
+    tracked.clear(reclaimer);
+    EXPECT_TRUE(tracked.isEmpty());
+
+    tracked.append(tracker);  // The list can be used again right away
+    EXPECT_EQ(1, tracked.computeSize());
+
+    reclaimer.waitUntilIdle();
+    EXPECT_EQ(2, tracker.use_count());
+
+    lst.clear(reclaimer);
+    EXPECT_TRUE(lst.isEmpty());
+}
+
 TEST_F(LinkedListTests, RangeDeletion) {
-    EXPECT_TRUE(false) << "Tests not implemented";
+    lst.erase(++lst.begin(), ++++++lst.begin());
+
+    EXPECT_EQ(1, *lst.begin());
+    EXPECT_EQ(4, *++lst.begin());
+    EXPECT_EQ(5, *++++lst.begin());
+    EXPECT_EQ(3, lst.computeSize());
+
+    lst.erase(lst.begin(), ++lst.begin());
+    EXPECT_EQ(4, *lst.begin());
+
+    lst.erase(++lst.begin(), lst.end());
+    EXPECT_EQ(1, lst.computeSize());
+    lst.append(6);  // The tail has to be the remaining node
+    EXPECT_EQ(6, *++lst.begin());
+
+    lst.erase(lst.begin(), lst.end());
+    EXPECT_TRUE(lst.isEmpty());
+}
+
+template <typename T>
+static std::vector<T> toVector(const LinkedList<T>& lst) {
+    std::vector<T> result;
+    for (const T& item : lst)
+        result.push_back(item);
+    return result;
+}
+
+TEST_F(LinkedListTests, Splice) {
+    LinkedList<int> other = {6, 7, 8, 9};
+    auto seven = ++other.begin();
+
+    lst.splice(++lst.begin(), other, seven, ++++++other.begin());
+    EXPECT_EQ(std::vector<int>({1, 7, 8, 2, 3, 4, 5}), toVector(lst));
+    EXPECT_EQ(std::vector<int>({6, 9}), toVector(other));
+    EXPECT_EQ(7, *seven);  // Iterators follow their nodes
+
+    lst.splice(lst.end(), other);
+    EXPECT_TRUE(other.isEmpty());
+    lst.append(10);
+    EXPECT_EQ(std::vector<int>({1, 7, 8, 2, 3, 4, 5, 6, 9, 10}), toVector(lst));
+
+    lst.splice(lst.begin(), lst, seven, ++++seven.next());  // Inside one list
+    EXPECT_EQ(std::vector<int>({7, 8, 2, 1, 3, 4, 5, 6, 9, 10}), toVector(lst));
+
+    other.splice(other.end(), lst, ++lst.begin(), lst.end());
+    other.append(11);
+    EXPECT_EQ(std::vector<int>({7}), toVector(lst));
+    EXPECT_EQ(std::vector<int>({8, 2, 1, 3, 4, 5, 6, 9, 10, 11}), toVector(other));
+}
+
+TEST_F(LinkedListTests, MergeAndSort) {
+    LinkedList<int> other = {0, 2, 2, 6};
+    lst.merge(other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 2, 2, 3, 4, 5, 6}), toVector(lst));
+
+    lst = {5, 3, 9, 1, 3, 7};
+    lst.sort();
+    EXPECT_EQ(std::vector<int>({1, 3, 3, 5, 7, 9}), toVector(lst));
+    lst.sort(std::greater<int>());
+    lst.append(0);
+    EXPECT_EQ(std::vector<int>({9, 7, 5, 3, 3, 1, 0}), toVector(lst));
+
+    // Both are stable
+    using Entry = std::pair<int, char>;
+    auto byKey = [](const Entry& lhs, const Entry& rhs) {
+        return lhs.first < rhs.first;
+    };
+    LinkedList<Entry> entries = {{2, 'a'}, {1, 'a'}, {2, 'b'}, {1, 'b'}, {0, 'a'}, {2, 'c'}};
+    entries.sort(byKey);
+    std::vector<Entry> expected = {{0, 'a'}, {1, 'a'}, {1, 'b'}, {2, 'a'}, {2, 'b'}, {2, 'c'}};
+    EXPECT_EQ(expected, toVector(entries));
+
+    LinkedList<Entry> more = {{1, 'c'}, {2, 'd'}};
+    entries.merge(more, byKey);
+    expected = {{0, 'a'}, {1, 'a'}, {1, 'b'}, {1, 'c'}, {2, 'a'}, {2, 'b'}, {2, 'c'}, {2, 'd'}};
+    EXPECT_EQ(expected, toVector(entries));
+
+    // A throwing comparator leaves all elements in the list
+    int comparisons = 0;
+    lst = {5, 3, 9, 1, 3, 7, 2, 8};
+    EXPECT_THROW(lst.sort([&comparisons](int lhs, int rhs) {
+        if (++comparisons == 6)
+            throw std::runtime_error("Comparator failed");
+        return lhs < rhs;
+    }), std::runtime_error);
+    std::vector<int> keys = toVector(lst);
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 3, 5, 7, 8, 9}), keys);
+    EXPECT_EQ(static_cast<int>(keys.size()), lst.computeSize());
+}
+
+TEST(LinkedListRandomTests, Sort) {
+    const int samples = 100000;
+    std::default_random_engine engine(50);
+    std::uniform_int_distribution<int> dist(0, 1000);
+
+    LinkedList<int> lst;
+    std::vector<int> expected;
+    for (int i = 0; i < samples; ++i) {
+        int key = dist(engine);
+        lst.append(key);
+        expected.push_back(key);
+    }
+
+    lst.sort();
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, toVector(lst));
+
+    // The prev pointers have to be restored as well
+    auto it = lst.begin();
+    while (it.next().isValid())
+        ++it;
+    std::vector<int> backwards;
+    for (; it.isValid(); --it)
+        backwards.push_back(*it);
+    EXPECT_TRUE(std::equal(expected.rbegin(), expected.rend(), backwards.begin(), backwards.end()));
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+
+#include "Heap/MinMaxHeap.h"
+
+struct MinMaxHeapTests : public testing::Test {
+    MinMaxHeap<int> heap = {50, 20, 80, 10, 70, 30, 60, 40, 90};
+
+    virtual void SetUp() override {
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(MinMaxHeapTests, BasicUsage) {
+    EXPECT_EQ(9u, heap.size());
+    EXPECT_EQ(10, heap.findMin());
+    EXPECT_EQ(90, heap.findMax());
+
+    EXPECT_EQ(90, heap.extractMax());
+    EXPECT_EQ(10, heap.extractMin());
+    EXPECT_EQ(80, heap.extractMax());
+
+    heap.insert(5);
+    heap.insert(95);
+    EXPECT_EQ(5, heap.findMin());
+    EXPECT_EQ(95, heap.findMax());
+
+    std::vector<int> expected = {5, 20, 30, 40, 50, 60, 70, 95};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractMin());
+
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.findMin(), std::runtime_error);
+    EXPECT_THROW(heap.findMax(), std::runtime_error);
+    EXPECT_THROW(heap.extractMin(), std::runtime_error);
+    EXPECT_THROW(heap.extractMax(), std::runtime_error);
+
+    heap.insert(1);
+    EXPECT_EQ(1, heap.findMin());
+    EXPECT_EQ(1, heap.findMax());
+    heap.insert(2);
+    EXPECT_EQ(2, heap.findMax());
+    EXPECT_EQ(2, heap.extractMax());
+    EXPECT_EQ(1, heap.extractMax());
+}
+
+TEST_F(MinMaxHeapTests, BoundedQueue) {
+    // Keep the 3 largest keys by evicting the smallest one whenever the queue is full
+    MinMaxHeap<std::string> queue;
+    for (std::string key : {"d", "a", "f", "b", "e", "c"}) {
+        queue.insert(std::move(key));
+        if (queue.size() > 3)
+            queue.extractMin();
+    }
+
+    EXPECT_EQ("f", queue.extractMax());
+    EXPECT_EQ("e", queue.extractMax());
+    EXPECT_EQ("d", queue.extractMax());
+
+    MinMaxHeap<int, std::greater<int>> reversed(std::vector<int>{3, 1, 2});
+    EXPECT_EQ(3, reversed.findMin());
+    EXPECT_EQ(1, reversed.findMax());
+}
+
+TEST(MinMaxHeapRandomTests, MixedOperations) {
+    const int samples = 5000;
+    std::default_random_engine engine(41);
+    std::uniform_int_distribution<int> dist(0, 1000);
+
+    std::vector<int> keys(samples);
+    for (int& key : keys)
+        key = dist(engine);
+
+    std::multiset<int> reference(keys.begin(), keys.end());
+    MinMaxHeap<int> heap(std::move(keys));
+
+    for (int i = 0; i < 4 * samples; ++i) {
+        switch (dist(engine) % 3) {
+            case 0: {
+                int key = dist(engine);
+                heap.insert(key);
+                reference.insert(key);
+                break;
+            }
+            case 1:
+                if (!reference.empty()) {
+                    EXPECT_EQ(*reference.begin(), heap.extractMin());
+                    reference.erase(reference.begin());
+                }
+                break;
+            default:
+                if (!reference.empty()) {
+                    EXPECT_EQ(*reference.rbegin(), heap.extractMax());
+                    reference.erase(std::prev(reference.end()));
+                }
+                break;
+        }
+
+        ASSERT_EQ(reference.size(), heap.size());
+        if (!reference.empty()) {
+            ASSERT_EQ(*reference.begin(), heap.findMin());
+            ASSERT_EQ(*reference.rbegin(), heap.findMax());
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Heap/MultiQueue.h"
+
+struct MultiQueueTests : public testing::Test {
+    MultiQueue<int> queue = MultiQueue<int>(4);
+    const int initialKeys = 1000;
+
+    virtual void SetUp() override {
+        for (int i = 0; i < initialKeys; ++i)
+            queue.insert(i);
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(MultiQueueTests, BasicUsage) {
+    EXPECT_EQ(8u, queue.queueCount());
+    EXPECT_EQ(1000u, queue.size());
+
+    int key;
+    std::vector<int> extracted;
+    while (queue.tryExtractExtremum(key))
+        extracted.push_back(key);
+
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.tryExtractExtremum(key));
+    ASSERT_EQ(1000u, extracted.size());
+
+    // The order is relaxed, but the first keys have to come from the beginning of the range
+    for (int i = 0; i < 10; ++i)
+        EXPECT_LT(extracted[i], 200);
+
+    std::sort(extracted.begin(), extracted.end());
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(i, extracted[i]);
+}
+
+TEST_F(MultiQueueTests, MaxQueue) {
+    MultiQueue<int, std::greater<int>> maxQueue(1);
+    EXPECT_EQ(2u, maxQueue.queueCount());
+    maxQueue.insert(3);
+    maxQueue.insert(7);
+
+    int key;
+    ASSERT_TRUE(maxQueue.tryExtractExtremum(key));
+    EXPECT_EQ(7, key);  // Both queues are looked at
+    ASSERT_TRUE(maxQueue.tryExtractExtremum(key));
+    EXPECT_EQ(3, key);
+}
+
+TEST_F(MultiQueueTests, Concurrent) {
+    const int threadCount = 4;
+    const int keysPerThread = 20000;
+    std::atomic<long long> extractedSum(0);
+    std::atomic<int> extractedCount(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            int key;
+            for (int i = 0; i < keysPerThread; ++i) {
+                queue.insert(initialKeys + t * keysPerThread + i);
+                if (i % 2 == 1 && queue.tryExtractExtremum(key)) {
+                    extractedSum += key;
+                    ++extractedCount;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    int key;
+    while (queue.tryExtractExtremum(key)) {
+        extractedSum += key;
+        ++extractedCount;
+    }
+
+    long long n = initialKeys + threadCount * keysPerThread;
+    EXPECT_EQ(n, extractedCount);
+    EXPECT_EQ(n * (n - 1) / 2, extractedSum);
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+
+#include "Heap/PairingHeap.h"
+
+struct PairingHeapTests : public testing::Test {
+    PairingHeap<int> heap;
+    std::vector<PairingHeap<int>::handle> handles;
+
+    virtual void SetUp() override {
+        for (int key : {50, 20, 80, 10, 70, 30, 60, 40})
+            handles.push_back(heap.insert(key));
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(PairingHeapTests, BasicUsage) {
+    EXPECT_EQ(8u, heap.size());
+    EXPECT_EQ(10, heap.extremum());
+    EXPECT_EQ(80, heap.key(handles[2]));
+
+    std::vector<int> expected = {10, 20, 30, 40, 50, 60, 70, 80};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractExtremum());
+
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.extremum(), std::runtime_error);
+    EXPECT_THROW(heap.extractExtremum(), std::runtime_error);
+
+    heap.insert(5);
+    heap.clear();
+    EXPECT_TRUE(heap.isEmpty());
+    heap.insert(3);
+    EXPECT_EQ(3, heap.extractExtremum());
+}
+
+TEST_F(PairingHeapTests, DecreaseKey) {
+    EXPECT_EQ(10, heap.extractExtremum());  // Gives the root children to cut from
+
+    heap.decreaseKey(handles[2], 5);  // 80 -> 5
+    EXPECT_EQ(5, heap.extremum());
+    heap.decreaseKey(handles[2], 1);  // The root itself
+    heap.decreaseKey(handles[6], 25);  // 60 -> 25
+    EXPECT_THROW(heap.decreaseKey(handles[0], 55), std::runtime_error);
+
+    std::vector<int> expected = {1, 20, 25, 30, 40, 50, 70};
+    for (int key : expected)
+        EXPECT_EQ(key, heap.extractExtremum());
+}
+
+TEST_F(PairingHeapTests, Meld) {
+    PairingHeap<int> other;
+    auto h = other.insert(45);
+    other.insert(5);
+    other.insert(90);
+
+    heap.meld(std::move(other));
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(11u, heap.size());
+    EXPECT_EQ(5, heap.extractExtremum());
+
+    // Handles of the other heap stay valid
+    heap.decreaseKey(h, 15);
+    EXPECT_EQ(10, heap.extractExtremum());
+    EXPECT_EQ(15, heap.extractExtremum());
+
+    // The other heap can still be used
+    other.insert(7);
+    EXPECT_EQ(7, other.extractExtremum());
+
+    PairingHeap<int> moved(std::move(heap));
+    EXPECT_EQ(8u, moved.size());
+    EXPECT_EQ(20, moved.extremum());
+}
+
+TEST_F(PairingHeapTests, PoolAdoption) {
+    NodePool<long long> pool;
+    NodePool<long long> other;
+    pool.allocate();
+    char* otherFirst = static_cast<char*>(other.allocate());  // The first block of a pool has 32 slots
+
+    // Both pools have 31 unused slots, one block keeps handing them out and the other one's become free slots
+    pool.adopt(other);
+    size_t inOtherBlock = 0;
+    std::set<void*> slots;
+    for (int i = 0; i < 62; ++i) {
+        char* slot = static_cast<char*>(pool.allocate());
+        slots.insert(slot);
+        if (slot > otherFirst && slot < otherFirst + 32 * sizeof(long long))
+            ++inOtherBlock;
+    }
+    EXPECT_EQ(62u, slots.size());
+    EXPECT_EQ(31u, inOtherBlock);
+}
+
+TEST_F(PairingHeapTests, NonTrivialKeys) {
+    PairingHeap<std::string, std::greater<std::string>> stringHeap;
+    stringHeap.emplace(3, 'b');
+    stringHeap.insert("a");
+    stringHeap.insert(std::string("c"));
+    EXPECT_EQ("c", stringHeap.extractExtremum());
+    EXPECT_EQ("bbb", stringHeap.extractExtremum());
+
+    // Decreasing keys build a chain as deep as the heap is large, which must not overflow the stack
+    PairingHeap<std::string> deepHeap;
+    for (int i = 200000; i > 0; --i)
+        deepHeap.insert(std::to_string(i));
+    EXPECT_EQ(200000u, deepHeap.size());
+
+    auto comp = [](const std::unique_ptr<int>& first, const std::unique_ptr<int>& second) { return *first < *second; };
+    PairingHeap<std::unique_ptr<int>, decltype(comp)> ptrHeap(comp);
+    ptrHeap.emplace(new int(2));
+    ptrHeap.insert(std::make_unique<int>(1));
+    EXPECT_EQ(1, *ptrHeap.extractExtremum());
+}
+
+TEST(PairingHeapRandomTests, MixedOperations) {
+    const int samples = 5000;
+    std::default_random_engine engine(39);
+    std::uniform_int_distribution<int> dist(0, 100000);
+
+    // Keys are unique (value * idRange + id), so every key identifies its handle
+    const long long idRange = 1000000;
+    long long nextId = 0;
+    auto randomKey = [&]() {
+        return dist(engine) * idRange + nextId++;
+    };
+
+    PairingHeap<long long> heap;
+    std::map<long long, PairingHeap<long long>::handle> live;
+
+    for (int i = 0; i < samples; ++i) {
+        long long key = randomKey();
+        live[key] = heap.insert(key);
+    }
+
+    for (int i = 0; i < samples; ++i) {
+        if (i % 3 == 0) {
+            PairingHeap<long long> other;
+            for (int j = 0; j < 3; ++j) {
+                long long key = randomKey();
+                live[key] = other.insert(key);
+            }
+            heap.meld(std::move(other));
+        } else if (i % 3 == 1) {
+            auto it = std::next(live.begin(), dist(engine) % live.size());
+            long long newKey = it->first - (dist(engine) % 1000) * idRange;
+            auto h = it->second;
+            live.erase(it);
+
+            heap.decreaseKey(h, newKey);
+            EXPECT_EQ(newKey, heap.key(h));
+            live[newKey] = h;
+        } else {
+            EXPECT_EQ(live.begin()->first, heap.extractExtremum());
+            live.erase(live.begin());
+        }
+    }
+
+    EXPECT_EQ(live.size(), heap.size());
+    for (auto& entry : live)
+        EXPECT_EQ(entry.first, heap.extractExtremum());
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Heap/Heap.h"
+#include "Heap/RadixHeap.h"
+
+struct RadixHeapTests : public testing::Test {
+    RadixHeap<unsigned, std::string> heap;
+
+    virtual void SetUp() override {
+        heap.insert(30, "thirty");
+        heap.insert(5, "five");
+        heap.insert(1000, "thousand");
+        heap.insert(5, "five again");
+        heap.insert(17, "seventeen");
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(RadixHeapTests, BasicUsage) {
+    EXPECT_EQ(5u, heap.size());
+    EXPECT_EQ(5u, heap.minKey());
+
+    EXPECT_EQ(5u, heap.extractMin().first);
+    EXPECT_EQ(5u, heap.extractMin().first);
+
+    auto entry = heap.extractMin();
+    EXPECT_EQ(17u, entry.first);
+    EXPECT_EQ("seventeen", entry.second);
+
+    // Keys equal to the last extracted key are allowed
+    heap.insert(17, "seventeen again");
+    EXPECT_THROW(heap.insert(16, "too small"), std::runtime_error);
+
+    EXPECT_EQ("seventeen again", heap.extractMin().second);
+    EXPECT_EQ(30u, heap.extractMin().first);
+    EXPECT_EQ(1000u, heap.extractMin().first);
+
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.extractMin(), std::runtime_error);
+    EXPECT_THROW(heap.minKey(), std::runtime_error);
+
+    heap.clear();
+    heap.insert(0, "zero");
+    EXPECT_EQ(0u, heap.extractMin().first);
+}
+
+TEST_F(RadixHeapTests, PeekBeforeInsert) {
+    RadixHeap<unsigned, int> peekHeap;
+    peekHeap.insert(5, 0);
+    peekHeap.insert(100, 1);
+    EXPECT_EQ(5u, peekHeap.extractMin().first);
+
+    // Peeking must not raise the bound for insertions above the last extracted key
+    EXPECT_EQ(100u, peekHeap.minKey());
+    peekHeap.insert(50, 2);
+    EXPECT_EQ(50u, peekHeap.minKey());
+    EXPECT_THROW(peekHeap.insert(4, 3), std::runtime_error);
+
+    EXPECT_EQ(50u, peekHeap.extractMin().first);
+    EXPECT_EQ(100u, peekHeap.extractMin().first);
+}
+
+TEST_F(RadixHeapTests, KeyTypes) {
+    RadixHeap<uint8_t, int> smallHeap;
+    smallHeap.insert(255, 1);
+    smallHeap.insert(0, 2);
+    smallHeap.insert(128, 3);
+    EXPECT_EQ(0, smallHeap.extractMin().first);
+    EXPECT_EQ(128, smallHeap.extractMin().first);
+    EXPECT_EQ(255, smallHeap.extractMin().first);
+
+    RadixHeap<uint64_t, int> largeHeap;
+    uint64_t max = std::numeric_limits<uint64_t>::max();
+    largeHeap.insert(max, 1);
+    largeHeap.insert(max - 1, 2);
+    largeHeap.insert(uint64_t(1) << 63, 3);
+    EXPECT_EQ(uint64_t(1) << 63, largeHeap.extractMin().first);
+    EXPECT_EQ(max - 1, largeHeap.extractMin().first);
+    EXPECT_EQ(max, largeHeap.extractMin().first);
+}
+
+TEST(RadixHeapRandomTests, Dijkstra) {
+    std::default_random_engine engine(40);
+
+    const size_t nodes = 2000;
+    std::uniform_int_distribution<size_t> nodeDist(0, nodes - 1);
+    std::uniform_int_distribution<uint32_t> weightDist(1, 1000);
+
+    std::vector<std::vector<std::pair<size_t, uint32_t>>> edges(nodes);
+    for (size_t i = 0; i < 8 * nodes; ++i)
+        edges[nodeDist(engine)].emplace_back(nodeDist(engine), weightDist(engine));
+
+    const uint32_t infinity = std::numeric_limits<uint32_t>::max();
+
+    std::vector<uint32_t> radixDistances(nodes, infinity);
+    RadixHeap<uint32_t, size_t> radixHeap;
+    radixDistances[0] = 0;
+    radixHeap.insert(0, 0);
+    while (!radixHeap.isEmpty()) {
+        auto entry = radixHeap.extractMin();
+        if (entry.first != radixDistances[entry.second])
+            continue;
+        for (auto& edge : edges[entry.second]) {
+            if (entry.first + edge.second < radixDistances[edge.first]) {
+                radixDistances[edge.first] = entry.first + edge.second;
+                radixHeap.insert(radixDistances[edge.first], edge.first);
+            }
+        }
+    }
+
+    std::vector<uint32_t> heapDistances(nodes, infinity);
+    Heap<std::pair<uint32_t, size_t>> heap;  // std::less makes it a min heap
+    heapDistances[0] = 0;
+    heap.insert({0, 0});
+    while (!heap.isEmpty()) {
+        auto entry = heap.extractExtremum();
+        if (entry.first != heapDistances[entry.second])
+            continue;
+        for (auto& edge : edges[entry.second]) {
+            if (entry.first + edge.second < heapDistances[edge.first]) {
+                heapDistances[edge.first] = entry.first + edge.second;
+                heap.insert({heapDistances[edge.first], edge.first});
+            }
+        }
+    }
+
+    EXPECT_EQ(heapDistances, radixDistances);
+}
\ No newline at end of file
@@ -1,5 +1,8 @@
+#include <algorithm>
+#include <cstddef>
 #include <random>
 #include <ctime>
+#include <functional>
 
 #include <gtest/gtest.h>
 
@@ -173,6 +176,216 @@ TEST_F(RedBlackTreeTests, Postorder) {
     EXPECT_EQ(expected, vec);
 }
 
+TEST_F(RedBlackTreeTests, DeletionKeepsIterators) {
+    auto successor = tree.find(50);
+    auto other = tree.find(10);
+
+    tree.erase(40);  // 40 has two children, so its successor 50 is moved up
+    EXPECT_EQ(50, tree.root().key());
+    EXPECT_EQ(50, successor.key());
+    EXPECT_EQ(60, successor.right().key());
+    EXPECT_FALSE(successor.hasParent());
+    EXPECT_EQ(10, other.key());
+
+    tree.erase(20);
+    EXPECT_EQ(50, successor.key());
+    EXPECT_EQ(10, other.key());
+    EXPECT_EQ(30, tree.root().left().key());
+}
+
+TEST_F(RedBlackTreeTests, Compact) {
+    RedBlackTree<int> treeCpy(tree);
+
+    EXPECT_FALSE(tree.compact(3));
+    EXPECT_EQ(treeCpy, tree);
+    EXPECT_FALSE(tree.compact(3));
+    EXPECT_TRUE(tree.compact(3));
+    EXPECT_EQ(treeCpy, tree);
+
+    // The tree may change between calls
+    EXPECT_FALSE(tree.compact(2));
+    tree.erase(30);
+    tree.insert(35);
+    EXPECT_TRUE(tree.compact(10));
+
+    std::vector<int> expected = {10, 20, 35, 40, 50, 60, 70};
+    EXPECT_EQ(expected, tree.inorder<std::vector<int>>());
+    EXPECT_EQ(20, tree.root().left().key());
+    EXPECT_EQ(20, tree.root().left().right().parent().key());
+
+    tree.erase(tree.root());
+    EXPECT_EQ(50, tree.root().key());
+}
+
+// Counts how often a key was copied and moved
+struct TrackedKey {
+    int value;
+    int copies = 0;
+    int moves = 0;
+
+    TrackedKey(int value) : value(value) {}
+    TrackedKey(const TrackedKey& other) : value(other.value), copies(other.copies + 1), moves(other.moves) {}
+    TrackedKey(TrackedKey&& other) : value(other.value), copies(other.copies), moves(other.moves + 1) {}
+    TrackedKey& operator=(const TrackedKey& other) = default;
+
+    bool operator<(const TrackedKey& other) const { return value < other.value; }
+    bool operator>(const TrackedKey& other) const { return value > other.value; }
+};
+
+TEST_F(RedBlackTreeTests, CompactMovesEveryNodeOnce) {
+    RedBlackTree<TrackedKey> trackedTree;
+    for (int value : {5, 3, 5, 7, 5, 5})
+        trackedTree.insert(value);
+
+    // Every call stops inside the run of equal keys, which must not skip the rest of it
+    size_t calls = 1;
+    while (!trackedTree.compact(1))
+        ++calls;
+    EXPECT_EQ(6u, calls);
+
+    std::vector<int> values;
+    for (const TrackedKey& key : trackedTree.inorderRange()) {
+        values.push_back(key.value);
+        EXPECT_EQ(1, key.copies);  // Only by insert()
+        EXPECT_EQ(1, key.moves);
+    }
+    std::vector<int> expected = {3, 5, 5, 5, 5, 7};
+    EXPECT_EQ(expected, values);
+
+    // Assigning another tree starts a new pass
+    EXPECT_FALSE(trackedTree.compact(5));
+    RedBlackTree<TrackedKey> other;
+    other.insert(1);
+    other.insert(2);
+    trackedTree = std::move(other);
+    EXPECT_FALSE(trackedTree.compact(1));
+    EXPECT_EQ(1, trackedTree.min().key().moves);
+    EXPECT_EQ(0, trackedTree.max().key().moves);
+}
+
+TEST_F(RedBlackTreeTests, CompactPlacesNeighboursTogether) {
+    // Erasing and inserting in random order scatters the nodes over the freed blocks
+    std::default_random_engine engine(30);
+    std::vector<int> keys(20000);
+    for (size_t i = 0; i < keys.size(); ++i)
+        keys[i] = static_cast<int>(i);
+    std::shuffle(keys.begin(), keys.end(), engine);
+
+    RedBlackTree<int> largeTree;
+    for (int key : keys)
+        largeTree.insert(key);
+    for (int round = 0; round < 3; ++round) {
+        std::shuffle(keys.begin(), keys.end(), engine);
+        for (size_t i = 0; i < keys.size() / 2; ++i)
+            largeTree.erase(keys[i]);
+        std::shuffle(keys.begin(), keys.begin() + keys.size() / 2, engine);
+        for (size_t i = 0; i < keys.size() / 2; ++i)
+            largeTree.insert(keys[i]);
+    }
+
+    while (!largeTree.compact(1000)) {
+    }
+
+    // The keys sit at the same offset in every node, so their distance is the distance of the nodes
+    size_t neighbours = 0;
+    size_t adjacent = 0;
+    const int* previous = nullptr;
+    for (const int& key : largeTree.inorderRange()) {
+        if (previous != nullptr) {
+            std::ptrdiff_t distance = reinterpret_cast<const char*>(&key) - reinterpret_cast<const char*>(previous);
+            ++neighbours;
+            if (distance > 0 && distance <= static_cast<std::ptrdiff_t>(2 * sizeof(RBTreeNode<int>)))
+                ++adjacent;
+        }
+        previous = &key;
+    }
+    EXPECT_EQ(keys.size() - 1, neighbours);
+    EXPECT_GE(adjacent, neighbours * 9 / 10);
+}
+
+TEST_F(RedBlackTreeTests, AssignSorted) {
+    std::vector<int> keys = {10, 20, 30, 40, 50, 60, 70, 80};
+    tree.assignSorted(keys.begin(), keys.end());
+
+    EXPECT_EQ(keys, tree.inorder<std::vector<int>>());
+    EXPECT_EQ(50, tree.root().key());
+    EXPECT_EQ(4u, tree.computeHeight());
+
+    // Must still be a valid Red-Black-Tree
+    for (int key : {15, 25, 35, 45})
+        tree.insert(key);
+    tree.erase(80);
+    tree.erase(50);
+    EXPECT_LE(tree.computeHeight(), 2 * log2(tree.computeSize() + 1) + 1);
+
+    tree.assignSorted(keys.begin(), keys.begin());
+    EXPECT_TRUE(tree.isEmpty());
+
+    std::vector<int> duplicates = {1, 1, 1, 2, 3, 3};
+    MultiRedBlackTree<int> multiTree;
+    multiTree.assignSorted(duplicates.begin(), duplicates.end());
+    EXPECT_EQ(2u, multiTree.computeHeight());
+    EXPECT_EQ(3u, multiTree.count(1));
+    EXPECT_EQ(duplicates, multiTree.inorder<std::vector<int>>());
+}
+
+TEST_F(RedBlackTreeTests, Multiset) {
+    MultiRedBlackTree<int> multiTree;
+    for (int i = 0; i < 100; ++i) {
+        multiTree.insert(i % 4);
+        multiTree.insert(10);
+    }
+
+    // Only 5 distinct keys, so only 5 nodes
+    std::vector<size_t> expectedDepths = {1, 2, 2};
+    EXPECT_EQ(expectedDepths, multiTree.computeDepthHistogram());
+    EXPECT_EQ(200u, multiTree.computeSize());
+    EXPECT_EQ(100u, multiTree.count(10));
+    EXPECT_EQ(25u, multiTree.count(3));
+
+    // Parallel traversals visit every copy
+    size_t copies = multiTree.parallelReduce(size_t(0), [](size_t acc, int) { return acc + 1; }, std::plus<size_t>(), 4);
+    EXPECT_EQ(200u, copies);
+
+    for (int i = 0; i < 25; ++i)
+        EXPECT_EQ(0, multiTree.extractMin());
+    EXPECT_EQ(0u, multiTree.count(0));
+    EXPECT_EQ(1, multiTree.minKey());
+
+    multiTree.erase(10);
+    EXPECT_EQ(99u, multiTree.count(10));
+    EXPECT_EQ(174u, multiTree.computeSize());
+    EXPECT_LE(multiTree.computeHeight(), 3u);
+}
+
+#ifdef BST_ENABLE_STATS
+TEST_F(RedBlackTreeTests, Stats) {
+    tree.clear();
+    tree.resetStats();
+
+    tree.insert(10);  // The new red root is recolored black
+    tree.insert(20);
+    EXPECT_EQ(0u, tree.stats().rotations);
+    EXPECT_EQ(1u, tree.stats().recolorings);
+
+    tree.insert(30);  // Needs one rotation and recolors the old and the new root
+    EXPECT_EQ(3u, tree.stats().inserts);
+    EXPECT_EQ(1u, tree.stats().rotations);
+    EXPECT_EQ(3u, tree.stats().recolorings);
+
+    tree.insert(40);  // Uncle is red: the parent and the uncle turn black, the grandparent red and then, as the root, black again
+    EXPECT_EQ(1u, tree.stats().rotations);
+    EXPECT_EQ(7u, tree.stats().recolorings);
+    EXPECT_EQ(0u, tree.stats().splaySteps);
+
+    tree.erase(40);
+    tree.erase(tree.find(10));
+    tree.erase(99);  // Not in the tree
+    EXPECT_EQ(2u, tree.stats().erases);
+    EXPECT_EQ(4u, tree.stats().inserts);
+}
+#endif
+
 struct RedBlackTreeRandomTests : public testing::Test {
     int samples = 1000;
     std::default_random_engine engine = std::default_random_engine(time(nullptr));
@@ -264,4 +477,52 @@ TEST_F(RedBlackTreeRandomTests, RandomNodeDeletion) {
         EXPECT_LE(tree.computeHeight(), 2 * log2(size) + 1);
         --size;
     }
+}
+
+TEST_F(RedBlackTreeRandomTests, MixedDeletion) {
+    size_t size = tree.computeSize();
+    while (!tree.isEmpty()) {
+        int key = dist(engine);
+        if (tree.find(key).isValid())
+            tree.erase(key);
+        else
+            tree.erase(getRandomNode(tree));
+        --size;
+
+        auto vec = tree.inorder<std::vector<int>>();
+        ASSERT_EQ(size, vec.size());
+        EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+        EXPECT_LE(tree.computeHeight(), 2 * log2(size + 1) + 1);
+    }
+}
+
+TEST_F(RedBlackTreeRandomTests, Compact) {
+    auto expected = tree.inorder<std::vector<int>>();
+    size_t height = tree.computeHeight();
+
+    while (!tree.compact(17))
+        ;
+
+    EXPECT_EQ(expected, tree.inorder<std::vector<int>>());
+    EXPECT_EQ(height, tree.computeHeight());
+
+    while (!tree.isEmpty())
+        tree.erase(tree.root());
+}
+
+TEST_F(RedBlackTreeRandomTests, AssignSorted) {
+    for (size_t size = 0; size < 200; ++size) {
+        std::vector<int> keys(size);
+        for (int& key : keys)
+            key = dist(engine);
+        std::sort(keys.begin(), keys.end());
+
+        tree.assignSorted(keys.begin(), keys.end());
+        ASSERT_EQ(keys, tree.inorder<std::vector<int>>());
+
+        while (!tree.isEmpty()) {
+            tree.erase(getRandomNode(tree));
+            EXPECT_LE(tree.computeHeight(), 2 * log2(tree.computeSize() + 1) + 1);
+        }
+    }
 }
\ No newline at end of file
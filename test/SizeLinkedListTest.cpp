@@ -1,7 +1,29 @@
 #include <gtest/gtest.h>
 
+#include <type_traits>
+#include <utility>
+
 #include "LinkedList/SizeLinkedList.h"
 
+template <class List, class Other, class = void>
+struct CanSplice : std::false_type {};
+
+template <class List, class Other>
+struct CanSplice<List, Other, std::void_t<decltype(std::declval<List&>().splice(std::declval<List&>().begin(), std::declval<Other&>()))>>
+    : std::true_type {};
+
+template <class List, class Other, class = void>
+struct CanMerge : std::false_type {};
+
+template <class List, class Other>
+struct CanMerge<List, Other, std::void_t<decltype(std::declval<List&>().merge(std::declval<Other&>()))>> : std::true_type {};
+
+// A plain LinkedList taking the nodes of a SizeLinkedList would leave its size wrong
+static_assert(CanSplice<SizeLinkedList<int>, SizeLinkedList<int>>::value);
+static_assert(CanMerge<SizeLinkedList<int>, SizeLinkedList<int>>::value);
+static_assert(!CanSplice<LinkedList<int>, SizeLinkedList<int>>::value);
+static_assert(!CanMerge<LinkedList<int>, SizeLinkedList<int>>::value);
+
 struct SizeLinkedListTests : public testing::Test {
     SizeLinkedList<int> lst;
 
@@ -108,6 +130,56 @@ TEST_F(SizeLinkedListTests, Deletion) {
     EXPECT_EQ(4, *++lst.begin());
 }
 
+TEST_F(SizeLinkedListTests, Reclaimer) {
+    ListReclaimer reclaimer;
+    lst.clear(reclaimer);
+    EXPECT_EQ(0u, lst.size());
+    EXPECT_TRUE(lst.isEmpty());
+
+    lst.append(1);
+    EXPECT_EQ(1u, lst.size());
+}
+
 TEST_F(SizeLinkedListTests, RangeDeletion) {
-    EXPECT_TRUE(false) << "Tests not implemented";
+    lst.erase(++lst.begin(), ++++++lst.begin());
+
+    EXPECT_EQ(3u, lst.size());
+    EXPECT_EQ(1, *lst.begin());
+    EXPECT_EQ(4, *++lst.begin());
+    EXPECT_EQ(5, *++++lst.begin());
+
+    lst.erase(++lst.begin(), lst.end());
+    EXPECT_EQ(1u, lst.size());
+
+    lst.erase(lst.begin(), lst.end());
+    EXPECT_EQ(0u, lst.size());
+    EXPECT_TRUE(lst.isEmpty());
+}
+
+TEST_F(SizeLinkedListTests, SpliceAndMerge) {
+    SizeLinkedList<int> other({6, 7, 8, 9});
+
+    lst.splice(lst.begin(), other, ++other.begin(), other.end());
+    EXPECT_EQ(8u, lst.size());
+    EXPECT_EQ(1u, other.size());
+
+    lst.splice(lst.end(), lst, lst.begin(), ++++lst.begin());  // Moving inside one list keeps the size
+    EXPECT_EQ(8u, lst.size());
+    EXPECT_EQ(9, *lst.begin());
+
+    lst.splice(lst.begin(), other);
+    EXPECT_EQ(9u, lst.size());
+    EXPECT_EQ(0u, other.size());
+    EXPECT_EQ(6, *lst.begin());
+
+    lst.sort();
+    other = {0, 10};
+    lst.merge(other);
+    EXPECT_EQ(11u, lst.size());
+    EXPECT_EQ(0u, other.size());
+
+    int expected = 0;
+    for (int key : lst)
+        EXPECT_EQ(expected++, key);
+    EXPECT_EQ(11, expected);
 }
\ No newline at end of file
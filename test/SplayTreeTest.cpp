@@ -156,4 +156,49 @@ TEST_F(SplayTreeTests, Deletion) {
     tree.erase(tree.root());
     EXPECT_FALSE(tree.root().isValid());
     EXPECT_TRUE(tree.isEmpty());
-}
\ No newline at end of file
+}
+
+TEST_F(SplayTreeTests, FindManyDoesNotSplay) {
+    std::vector<int> keys = {10, 20, 90};
+    std::vector<SplayTree<int>::iterator> result;
+    tree.findMany(keys, result);
+
+    EXPECT_EQ(70, tree.root().key());
+    EXPECT_EQ(10, result[0].key());
+    EXPECT_EQ(20, result[1].key());
+    EXPECT_FALSE(result[2].isValid());
+}
+
+TEST_F(SplayTreeTests, Multiset) {
+    MultiSplayTree<int> multiTree;
+    multiTree.insert(5);
+    multiTree.insert(3);
+    multiTree.insert(5);
+
+    EXPECT_EQ(5, multiTree.root().key());
+    EXPECT_EQ(2u, multiTree.count(5));
+    EXPECT_EQ(2u, multiTree.computeDepthHistogram().size());
+
+    multiTree.erase(5);
+    EXPECT_EQ(1u, multiTree.count(5));
+    multiTree.erase(multiTree.find(5));
+    EXPECT_EQ(0u, multiTree.count(5));
+    EXPECT_EQ(3, multiTree.root().key());
+}
+
+#ifdef BST_ENABLE_STATS
+TEST_F(SplayTreeTests, Stats) {
+    tree.resetStats();
+
+    tree.find(10);  // 10 is the left-left-left-left grandchild of the root, so this takes two zig-zig steps
+    EXPECT_EQ(1u, tree.stats().searches);
+    EXPECT_EQ(5u, tree.stats().maxSearchDepth);
+    EXPECT_EQ(2u, tree.stats().splaySteps);
+    EXPECT_EQ(4u, tree.stats().rotations);
+    EXPECT_EQ(10, tree.root().key());
+
+    tree.find(10);
+    EXPECT_EQ(2u, tree.stats().splaySteps);
+    EXPECT_EQ(3.0, tree.stats().averageSearchDepth());
+}
+#endif
\ No newline at end of file
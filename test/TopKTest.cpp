@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Heap/TopK.h"
+
+struct TopKTests : public testing::Test {
+    TopK<int> top = TopK<int>(3);
+
+    virtual void SetUp() override {
+    }
+
+    virtual void TearDown() override {
+    }
+};
+
+TEST_F(TopKTests, BasicUsage) {
+    EXPECT_EQ(3u, top.capacity());
+    EXPECT_TRUE(top.insert(5));
+    EXPECT_TRUE(top.insert(1));
+    EXPECT_TRUE(top.insert(8));
+    EXPECT_TRUE(top.isFull());
+    EXPECT_EQ(1, top.threshold());
+
+    EXPECT_FALSE(top.insert(0));
+    EXPECT_FALSE(top.insert(1));  // Has to beat the threshold
+    EXPECT_TRUE(top.insert(7));
+    EXPECT_EQ(5, top.threshold());
+    EXPECT_EQ(3u, top.size());
+
+    std::vector<int> expected = {8, 7, 5};
+    EXPECT_EQ(expected, top.extractSorted());
+    EXPECT_EQ(0u, top.size());
+
+    EXPECT_THROW(TopK<int>(0), std::runtime_error);
+}
+
+TEST_F(TopKTests, Merge) {
+    TopK<std::string, std::greater<std::string>> smallest(2);  // With std::greater the smallest strings are kept
+    TopK<std::string, std::greater<std::string>> other(2);
+    for (std::string key : {"m", "c", "x"})
+        smallest.insert(std::move(key));
+    for (std::string key : {"a", "z", "d"})
+        other.insert(key);
+
+    smallest.merge(std::move(other));
+    EXPECT_EQ(0u, other.size());
+
+    std::vector<std::string> expected = {"a", "c"};
+    EXPECT_EQ(expected, smallest.extractSorted());
+}
+
+TEST(TopKRandomTests, Selection) {
+    const int samples = 100000;
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+
+    std::vector<int> keys(samples);
+    for (int& key : keys)
+        key = dist(engine);
+
+    std::vector<int> expected = keys;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    expected.resize(1000);
+
+    TopK<int> top(1000);
+    for (int key : keys)
+        top.insert(key);
+    EXPECT_EQ(expected, top.extractSorted());
+
+    for (size_t threads : {1, 3, 8}) {
+        auto parallelTop = TopK<int>::parallelSelect(keys.begin(), keys.end(), 1000, threads);
+        EXPECT_EQ(expected, parallelTop.extractSorted());
+    }
+
+    // Fewer elements than k
+    auto smallTop = TopK<int>::parallelSelect(keys.begin(), keys.begin() + 10, 1000, 4);
+    EXPECT_EQ(10u, smallTop.size());
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LinkedList/UnrolledLinkedList.h"
+
+struct UnrolledLinkedListTests : public testing::Test {
+    UnrolledLinkedList<int, 4> lst;
+
+    virtual void SetUp() override {
+        lst = UnrolledLinkedList<int, 4>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    }
+
+    virtual void TearDown() override {
+    }
+
+    template <class List>
+    static std::vector<typename List::iterator::value_type> toVector(const List& list) {
+        return std::vector<typename List::iterator::value_type>(list.begin(), list.end());
+    }
+};
+
+TEST_F(UnrolledLinkedListTests, Constructor) {
+    UnrolledLinkedList<int, 4> lstCpy(lst);
+    EXPECT_EQ(toVector(lst), toVector(lstCpy));
+
+    UnrolledLinkedList<int, 4> lstMove(std::move(lst));
+    EXPECT_EQ(toVector(lstCpy), toVector(lstMove));
+    EXPECT_TRUE(lst.isEmpty());
+
+    lst = lstCpy;
+    EXPECT_EQ(10, lst.computeSize());
+    lstCpy = std::move(lstMove);
+    EXPECT_EQ(toVector(lst), toVector(lstCpy));
+}
+
+TEST_F(UnrolledLinkedListTests, Insertion) {
+    lst.clear();
+
+    lst.insert(1, lst.begin());
+    lst.insert(4, ++lst.begin());
+    lst.insert(2, ++lst.begin());
+    lst.insert(3, ++++lst.begin());
+    lst.insert(5, ++++++++lst.begin());
+    lst.insert(0, lst.begin());  // Splits the first node
+
+    std::vector<int> expected = {0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(expected, toVector(lst));
+
+    UnrolledLinkedList<std::string, 3> strings;
+    for (std::string key : {"b", "d", "f"})
+        strings.append(key);
+    strings.insert("e", ++++strings.begin());
+    strings.insert("c", ++strings.begin());
+    strings.insert("a", strings.begin());
+    std::vector<std::string> expectedStrings = {"a", "b", "c", "d", "e", "f"};
+    EXPECT_EQ(expectedStrings, toVector(strings));
+}
+
+TEST_F(UnrolledLinkedListTests, Iteration) {
+    auto it = lst.begin();
+    for (int i = 0; i < 9; ++i)
+        ++it;
+    EXPECT_EQ(10, *it);
+    EXPECT_FALSE(it.next().isValid());
+
+    for (int expected = 10; expected > 1; --expected, --it)
+        EXPECT_EQ(expected, *it);
+    EXPECT_EQ(1, *it);
+    EXPECT_FALSE(it.prev().isValid());
+
+    for (int& key : lst)
+        key *= 2;
+    EXPECT_EQ(20, *++++++++++++++++++lst.begin());
+    EXPECT_THROW(++lst.end(), std::runtime_error);
+}
+
+TEST_F(UnrolledLinkedListTests, Deletion) {
+    lst.erase(++++lst.begin());
+    lst.erase(lst.begin());
+
+    auto it = lst.begin();
+    while (it.next().isValid())
+        ++it;
+    lst.erase(it);
+
+    std::vector<int> expected = {2, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(expected, toVector(lst));
+
+    while (!lst.isEmpty())
+        lst.erase(lst.begin());
+    EXPECT_EQ(0, lst.computeSize());
+}
+
+TEST_F(UnrolledLinkedListTests, RangeDeletion) {
+    auto start = ++lst.begin();
+    auto end = start;
+    for (int i = 0; i < 7; ++i)
+        ++end;
+    lst.erase(start, end);  // Spans several nodes
+
+    std::vector<int> expected = {1, 9, 10};
+    EXPECT_EQ(expected, toVector(lst));
+
+    lst.erase(++lst.begin(), ++++lst.begin());  // Inside one node
+    expected = {1, 10};
+    EXPECT_EQ(expected, toVector(lst));
+
+    lst.erase(lst.begin(), lst.end());
+    EXPECT_TRUE(lst.isEmpty());
+}
+
+TEST(UnrolledLinkedListRandomTests, AgainstList) {
+    const int samples = 20000;
+    std::default_random_engine engine(47);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+
+    UnrolledLinkedList<int, 5> lst;
+    std::list<int> expected;
+
+    for (int i = 0; i < samples; ++i) {
+        int operation = dist(engine) % 8;
+        int size = static_cast<int>(expected.size());
+        int position = size == 0 ? 0 : dist(engine) % (size + 1);
+
+        auto it = lst.begin();
+        auto expectedIt = expected.begin();
+        for (int j = 0; j < position; ++j, ++it, ++expectedIt) {}
+
+        if (operation < 3 || size == 0) {
+            lst.insert(i, it);
+            expected.insert(expectedIt, i);
+        } else if (operation < 5) {
+            lst.append(i);
+            expected.push_back(i);
+        } else if (operation < 7) {
+            if (position == size)
+                continue;
+            lst.erase(it);
+            expected.erase(expectedIt);
+        } else {
+            int count = dist(engine) % std::min(12, size - position + 1);
+            auto end = it;
+            auto expectedEnd = expectedIt;
+            for (int j = 0; j < count; ++j, ++end, ++expectedEnd) {}
+            lst.erase(it, end);
+            expected.erase(expectedIt, expectedEnd);
+        }
+
+        ASSERT_EQ(static_cast<int>(expected.size()), lst.computeSize());
+    }
+
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), lst.begin(), lst.end()));
+    auto it = lst.end();
+    if (!expected.empty()) {
+        it = lst.begin();
+        for (size_t j = 1; j < expected.size(); ++j)
+            ++it;
+        for (auto expectedIt = expected.rbegin(); expectedIt != expected.rend(); ++expectedIt, --it)
+            ASSERT_EQ(*expectedIt, *it);
+    }
+}
\ No newline at end of file